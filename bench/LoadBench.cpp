@@ -0,0 +1,544 @@
+#include <boost/asio.hpp>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <charconv>
+#include "format.pb.h"
+#include "Protocol.h"
+#include "Histogram.h"
+
+// Load generator for a running server: many connections over many threads send a GET/SET mix
+// and the reply latencies are reported as JSON on stdout, for tracking and gating releases.
+//
+// Closed loop (default) keeps --pipeline requests outstanding per connection. Open loop
+// (--rate <ops/s>) sends on a fixed schedule whatever the replies do, and measures each latency
+// from the time the request was due rather than sent, so a stalled server is charged for the
+// requests it held up (no coordinated omission).
+//
+// Usage: bench [--host 127.0.0.1] [--port 12345] [--threads N] [--connections N]
+//              [--duration s] [--warmup s] [--keys N] [--key-size B] [--value-size B]
+//              [--reads %] [--distribution uniform|zipf] [--zipf-theta 0.99, below 1]
+//              [--pipeline N] [--rate ops/s] [--preload on|off]
+
+using boost::asio::ip::tcp;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+struct BenchConfig
+{
+    std::string mHost {"127.0.0.1"};
+    uint16_t mPort {12345};
+    uint32_t mThreads {std::max(1u, std::thread::hardware_concurrency())};
+    uint32_t mConnections {0};
+    double mDuration {10.0};
+    double mWarmup {1.0};
+    uint32_t mKeys {100'000};
+    uint32_t mKeySize {16};
+    uint32_t mValueSize {64};
+    uint32_t mReadPercentage {90};
+    bool mZipf {false};
+    double mZipfTheta {0.99};
+    uint32_t mPipeline {1};
+    double mRate {0.0};
+    bool mPreload {true};
+};
+
+template<typename T>
+bool ParseValue(std::string_view aText, T& aValue)
+{
+    auto [lPtr, lError] = std::from_chars(aText.data(), aText.data() + aText.size(), aValue);
+    return lError == std::errc{} && lPtr == aText.data() + aText.size();
+}
+
+bool ParseOption(BenchConfig& aConfig, std::string_view aOption, std::string_view aValue)
+{
+    if(aOption == "--host")
+    {
+        aConfig.mHost = aValue;
+        return true;
+    }
+    if(aOption == "--distribution" && (aValue == "uniform" || aValue == "zipf"))
+    {
+        aConfig.mZipf = aValue == "zipf";
+        return true;
+    }
+    if(aOption == "--zipf-theta")
+    {
+        // The generator's constants divide by 1 - theta; YCSB's method holds for 0 <= theta < 1.
+        return ParseValue(aValue, aConfig.mZipfTheta) && aConfig.mZipfTheta >= 0.0 && aConfig.mZipfTheta < 1.0;
+    }
+    if(aOption == "--preload" && (aValue == "on" || aValue == "off"))
+    {
+        aConfig.mPreload = aValue == "on";
+        return true;
+    }
+    return (aOption == "--port" && ParseValue(aValue, aConfig.mPort)) ||
+           (aOption == "--threads" && ParseValue(aValue, aConfig.mThreads)) ||
+           (aOption == "--connections" && ParseValue(aValue, aConfig.mConnections)) ||
+           (aOption == "--duration" && ParseValue(aValue, aConfig.mDuration)) ||
+           (aOption == "--warmup" && ParseValue(aValue, aConfig.mWarmup)) ||
+           (aOption == "--keys" && ParseValue(aValue, aConfig.mKeys)) ||
+           (aOption == "--key-size" && ParseValue(aValue, aConfig.mKeySize)) ||
+           (aOption == "--value-size" && ParseValue(aValue, aConfig.mValueSize)) ||
+           (aOption == "--reads" && ParseValue(aValue, aConfig.mReadPercentage)) ||
+           (aOption == "--pipeline" && ParseValue(aValue, aConfig.mPipeline)) ||
+           (aOption == "--rate" && ParseValue(aValue, aConfig.mRate));
+}
+
+// Key i, zero padded to the key size (longer when the index needs more digits).
+std::string MakeKey(uint32_t aIndex, uint32_t aKeySize)
+{
+    std::string lDigits = std::to_string(aIndex);
+    std::string lKey {"k"};
+    if(lDigits.size() + 1 < aKeySize)
+    {
+        lKey.append(aKeySize - lDigits.size() - 1, '0');
+    }
+    return lKey + lDigits;
+}
+
+// Zipfian ranks as in YCSB (Gray et al., "Quickly generating billion-record synthetic
+// databases"): rank 0 is the most popular, with probability proportional to 1 / (rank + 1)^theta.
+class ZipfGenerator
+{
+public:
+    ZipfGenerator(uint32_t aItems, double aTheta) : mItems{aItems}, mTheta{aTheta}
+    {
+        for(uint32_t i = 1; i <= aItems; ++i)
+        {
+            mZetaN += 1.0 / std::pow(static_cast<double>(i), aTheta);
+        }
+        const double lZeta2 = 1.0 + 1.0 / std::pow(2.0, aTheta);
+        mAlpha = 1.0 / (1.0 - aTheta);
+        mEta = (1.0 - std::pow(2.0 / aItems, 1.0 - aTheta)) / (1.0 - lZeta2 / mZetaN);
+    }
+
+    template<typename Random>
+    uint32_t operator()(Random& aRandom) const
+    {
+        const double lU = std::uniform_real_distribution<double>{0.0, 1.0}(aRandom);
+        const double lUz = lU * mZetaN;
+        if(lUz < 1.0)
+        {
+            return 0;
+        }
+        if(lUz < 1.0 + std::pow(0.5, mTheta))
+        {
+            return std::min<uint32_t>(1, mItems - 1);
+        }
+        const double lRank = mItems * std::pow(mEta * lU - mEta + 1.0, mAlpha);
+        return std::min(static_cast<uint32_t>(lRank), mItems - 1);
+    }
+
+private:
+    uint32_t mItems;
+    double mTheta;
+    double mZetaN {0.0};
+    double mAlpha {0.0};
+    double mEta {0.0};
+};
+
+// Status field of a serialized pkg::Response, read without parsing the (possibly large) value.
+pkg::Status ReplyStatus(std::string_view aReply)
+{
+    std::size_t i {0};
+    auto lVarint = [&]() -> uint64_t {
+        uint64_t lValue {0};
+        for(uint32_t lShift = 0; i < aReply.size(); lShift += 7)
+        {
+            const auto lByte = static_cast<unsigned char>(aReply[i++]);
+            lValue |= static_cast<uint64_t>(lByte & 0x7F) << lShift;
+            if(lByte < 0x80)
+            {
+                break;
+            }
+        }
+        return lValue;
+    };
+    while(i < aReply.size())
+    {
+        const uint64_t lTag = lVarint();
+        const uint64_t lWireType = lTag & 7;
+        if(lTag >> 3 == pkg::Response::kStatusFieldNumber && lWireType == 0)
+        {
+            return static_cast<pkg::Status>(lVarint());
+        }
+        if(lWireType == 0)
+        {
+            lVarint();
+        }
+        else if(lWireType == 2)
+        {
+            i += lVarint();
+        }
+        else
+        {
+            break;
+        }
+    }
+    return pkg::STATUS_OK;
+}
+
+struct Workload
+{
+    const BenchConfig& mConfig;
+    std::vector<std::string> mKeys;
+    std::string mValue;
+    std::unique_ptr<ZipfGenerator> mZipf;
+    Clock::time_point mMeasureFrom;
+    Clock::time_point mMeasureUntil;
+};
+
+// Results of one thread, merged at the end.
+struct ThreadStats
+{
+    Histogram mGet;
+    Histogram mSet;
+    uint64_t mErrors {0};
+};
+
+// One connection of a load thread. Requests are encoded into mPending and written in batches,
+// a new batch once the previous write completed; replies are matched to the FIFO of due
+// times, since the server answers in order.
+class BenchConnection : public std::enable_shared_from_this<BenchConnection>
+{
+public:
+    BenchConnection(boost::asio::io_context& aIOContext, const Workload& aWorkload, ThreadStats& aStats, uint64_t aSeed)
+        : mSocket{aIOContext}, mTimer{aIOContext}, mWorkload{aWorkload}, mStats{aStats}, mRandom{aSeed}
+    {
+        const uint32_t lKeys = static_cast<uint32_t>(aWorkload.mKeys.size());
+        mUniform = std::uniform_int_distribution<uint32_t>{0, lKeys - 1};
+    }
+
+    void Connect(const tcp::endpoint& aEndpoint)
+    {
+        mSocket.connect(aEndpoint);
+        mSocket.set_option(tcp::no_delay(true));
+        boost::asio::write(mSocket, boost::asio::buffer(gProtocolPreamble));
+        char lAck[gProtocolPreambleLength];
+        boost::asio::read(mSocket, boost::asio::buffer(lAck));
+        if(IsProtocolPreamble(lAck) == false)
+        {
+            throw std::runtime_error("Server does not support the binary protocol");
+        }
+    }
+
+    // Stores every aStride-th key starting at aFirst, aDepth requests at a time, blocking.
+    void Preload(uint32_t aFirst, uint32_t aStride, uint32_t aDepth)
+    {
+        uint32_t lOutstanding {0};
+        for(uint32_t i = aFirst; i < mWorkload.mKeys.size() || lOutstanding > 0;)
+        {
+            while(i < mWorkload.mKeys.size() && lOutstanding < aDepth)
+            {
+                Encode(pkg::OP_SET, mWorkload.mKeys[i]);
+                i += aStride;
+                ++lOutstanding;
+            }
+            boost::asio::write(mSocket, boost::asio::buffer(mPending));
+            mPending.clear();
+            for(; lOutstanding > 0; --lOutstanding)
+            {
+                char lHeader[gBinaryHeaderLength];
+                boost::asio::read(mSocket, boost::asio::buffer(lHeader));
+                std::string lReply(DecodeLength(ProtocolVersion::BINARY_V2, lHeader).value(), '\0');
+                boost::asio::read(mSocket, boost::asio::buffer(lReply));
+            }
+        }
+    }
+
+    void Start(double aRatePerConnection)
+    {
+        Read();
+        if(aRatePerConnection > 0.0)
+        {
+            mInterval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / aRatePerConnection));
+            mNextDue = Clock::now();
+            SendDue();
+            return;
+        }
+        for(uint32_t i = 0; i < mWorkload.mConfig.mPipeline; ++i)
+        {
+            SendNext(Clock::now());
+        }
+        Flush();
+    }
+
+private:
+    void Encode(pkg::Op aOp, const std::string& aKey)
+    {
+        mRequest.Clear();
+        mRequest.set_op(aOp);
+        mRequest.set_key(aKey);
+        if(aOp == pkg::OP_SET)
+        {
+            mRequest.set_value(mWorkload.mValue);
+        }
+        const std::size_t lLength = mRequest.ByteSizeLong();
+        const std::size_t lOffset = mPending.size();
+        mPending.resize(lOffset + gBinaryHeaderLength + lLength);
+        EncodeLength(ProtocolVersion::BINARY_V2, static_cast<uint32_t>(lLength), mPending.data() + lOffset);
+        mRequest.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(mPending.data() + lOffset + gBinaryHeaderLength));
+    }
+
+    // Queues one request of the mix, due at aDue.
+    void SendNext(Clock::time_point aDue)
+    {
+        const uint32_t lIndex = mWorkload.mZipf ? (*mWorkload.mZipf)(mRandom) : mUniform(mRandom);
+        const bool lRead = mPercent(mRandom) < mWorkload.mConfig.mReadPercentage;
+        Encode(lRead ? pkg::OP_GET : pkg::OP_SET, mWorkload.mKeys[lIndex]);
+        mInFlight.push_back({aDue, lRead});
+    }
+
+    // Open loop: queues every request due by now, then sleeps until the next one is. Requests
+    // due while mMaxOutstanding are unanswered are not sent but counted as errors.
+    void SendDue()
+    {
+        const Clock::time_point lNow = Clock::now();
+        while(mNextDue <= lNow)
+        {
+            if(mInFlight.size() < mMaxOutstanding)
+            {
+                SendNext(mNextDue);
+            }
+            else if(mNextDue >= mWorkload.mMeasureFrom && mNextDue < mWorkload.mMeasureUntil)
+            {
+                ++mStats.mErrors;
+            }
+            mNextDue += mInterval;
+        }
+        Flush();
+        mTimer.expires_at(mNextDue);
+        mTimer.async_wait([me=shared_from_this()](const boost::system::error_code& aError){
+            if(!aError)
+            {
+                me->SendDue();
+            }
+        });
+    }
+
+    void Flush()
+    {
+        if(mWriting || mPending.empty())
+        {
+            return;
+        }
+        mWriting = true;
+        mSending.swap(mPending);
+        boost::asio::async_write(mSocket, boost::asio::buffer(mSending), [me=shared_from_this()](const boost::system::error_code& aError, std::size_t){
+            me->mWriting = false;
+            me->mSending.clear();
+            if(!aError)
+            {
+                me->Flush();
+            }
+        });
+    }
+
+    void Read()
+    {
+        char* lTail = mReceived.Prepare(FrameBuffer::mMinReadSize);
+        mSocket.async_read_some(boost::asio::buffer(lTail, mReceived.FreeSpace()), [me=shared_from_this()](const boost::system::error_code& aError, std::size_t aBytes){
+            if(aError)
+            {
+                return;
+            }
+            me->mReceived.Commit(aBytes);
+            me->OnReplies();
+            me->Read();
+        });
+    }
+
+    void OnReplies()
+    {
+        const Clock::time_point lNow = Clock::now();
+        const bool lMeasured = lNow >= mWorkload.mMeasureFrom && lNow < mWorkload.mMeasureUntil;
+        std::string_view lFrame;
+        std::size_t lMissing {0};
+        while(mInFlight.empty() == false && mReceived.NextFrame(ProtocolVersion::BINARY_V2, lFrame, lMissing) == FrameStatus::COMPLETE)
+        {
+            const Sent lSent = mInFlight.front();
+            mInFlight.pop_front();
+            if(lMeasured)
+            {
+                const auto lLatency = std::chrono::duration_cast<std::chrono::nanoseconds>(lNow - lSent.mDue).count();
+                (lSent.mRead ? mStats.mGet : mStats.mSet).Record(static_cast<uint64_t>(std::max<int64_t>(lLatency, 0)));
+                const pkg::Status lStatus = ReplyStatus(lFrame);
+                mStats.mErrors += lStatus != pkg::STATUS_OK && lStatus != pkg::STATUS_NOT_FOUND;
+            }
+            if(mInterval == Clock::duration::zero())
+            {
+                SendNext(lNow);
+            }
+        }
+        Flush();
+    }
+
+    struct Sent
+    {
+        Clock::time_point mDue;
+        bool mRead;
+    };
+
+    // Open loop requests due while this many are unanswered are skipped and counted as errors,
+    // so a dead server does not make the generator queue without bound.
+    static constexpr std::size_t mMaxOutstanding {1 << 16};
+
+    tcp::socket mSocket;
+    boost::asio::steady_timer mTimer;
+    const Workload& mWorkload;
+    ThreadStats& mStats;
+    std::mt19937_64 mRandom;
+    std::uniform_int_distribution<uint32_t> mUniform;
+    std::uniform_int_distribution<uint32_t> mPercent {0, 99};
+    pkg::Request mRequest;
+    std::string mPending;
+    std::string mSending;
+    bool mWriting {false};
+    FrameBuffer mReceived;
+    std::deque<Sent> mInFlight;
+    Clock::duration mInterval {Clock::duration::zero()};
+    Clock::time_point mNextDue;
+};
+
+void WriteLatencies(std::ostream& aOut, const Histogram& aHistogram)
+{
+    auto lMicros = [](uint64_t aNanos){ return static_cast<double>(aNanos) / 1000.0; };
+    aOut << "{\"count\": " << aHistogram.Count()
+         << ", \"mean\": " << lMicros(static_cast<uint64_t>(aHistogram.Mean()))
+         << ", \"p50\": " << lMicros(aHistogram.Percentile(0.50))
+         << ", \"p90\": " << lMicros(aHistogram.Percentile(0.90))
+         << ", \"p99\": " << lMicros(aHistogram.Percentile(0.99))
+         << ", \"p999\": " << lMicros(aHistogram.Percentile(0.999))
+         << ", \"max\": " << lMicros(aHistogram.Max()) << "}";
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    BenchConfig lConfig {};
+    for(int i = 1; i + 1 < argc; i += 2)
+    {
+        if(ParseOption(lConfig, argv[i], argv[i + 1]) == false)
+        {
+            std::cerr << "Invalid option " << argv[i] << " " << argv[i + 1] << "\n";
+            return 1;
+        }
+    }
+    lConfig.mThreads = std::max(1u, lConfig.mThreads);
+    lConfig.mConnections = std::max(lConfig.mConnections == 0 ? lConfig.mThreads : lConfig.mConnections, lConfig.mThreads);
+    lConfig.mKeys = std::max(1u, lConfig.mKeys);
+    lConfig.mPipeline = std::max(1u, lConfig.mPipeline);
+
+    Workload lWorkload {lConfig, {}, std::string(lConfig.mValueSize, 'v'), nullptr, {}, {}};
+    for(uint32_t i = 0; i < lConfig.mKeys; ++i)
+    {
+        lWorkload.mKeys.push_back(MakeKey(i, lConfig.mKeySize));
+    }
+    if(lConfig.mZipf)
+    {
+        lWorkload.mZipf = std::make_unique<ZipfGenerator>(lConfig.mKeys, lConfig.mZipfTheta);
+    }
+
+    try
+    {
+        const tcp::endpoint lEndpoint{boost::asio::ip::make_address(lConfig.mHost), lConfig.mPort};
+        std::vector<std::unique_ptr<boost::asio::io_context>> lContexts;
+        std::vector<ThreadStats> lStats(lConfig.mThreads);
+        std::vector<std::shared_ptr<BenchConnection>> lConnections;
+        for(uint32_t t = 0; t < lConfig.mThreads; ++t)
+        {
+            lContexts.push_back(std::make_unique<boost::asio::io_context>(1));
+        }
+        for(uint32_t c = 0; c < lConfig.mConnections; ++c)
+        {
+            const uint32_t lThread = c % lConfig.mThreads;
+            lConnections.push_back(std::make_shared<BenchConnection>(*lContexts[lThread], lWorkload, lStats[lThread], c + 1));
+            lConnections.back()->Connect(lEndpoint);
+        }
+
+        if(lConfig.mPreload)
+        {
+            std::vector<std::thread> lLoaders;
+            for(uint32_t c = 0; c < lConfig.mConnections; ++c)
+            {
+                lLoaders.emplace_back([&, c](){
+                    lConnections[c]->Preload(c, lConfig.mConnections, 64);
+                });
+            }
+            for(auto& lLoader : lLoaders)
+            {
+                lLoader.join();
+            }
+        }
+
+        const Clock::time_point lStart = Clock::now();
+        lWorkload.mMeasureFrom = lStart + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(lConfig.mWarmup));
+        lWorkload.mMeasureUntil = lWorkload.mMeasureFrom + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(lConfig.mDuration));
+        for(auto& lConnection : lConnections)
+        {
+            lConnection->Start(lConfig.mRate / lConfig.mConnections);
+        }
+
+        std::vector<std::thread> lThreads;
+        for(auto& lContext : lContexts)
+        {
+            lThreads.emplace_back([&lContext, &lWorkload](){
+                lContext->run_until(lWorkload.mMeasureUntil);
+            });
+        }
+        for(auto& lThread : lThreads)
+        {
+            lThread.join();
+        }
+
+        Histogram lGet;
+        Histogram lSet;
+        uint64_t lErrors {0};
+        for(const ThreadStats& lThreadStats : lStats)
+        {
+            lGet.Merge(lThreadStats.mGet);
+            lSet.Merge(lThreadStats.mSet);
+            lErrors += lThreadStats.mErrors;
+        }
+        Histogram lAll = lGet;
+        lAll.Merge(lSet);
+
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "{\"config\": {\"threads\": " << lConfig.mThreads << ", \"connections\": " << lConfig.mConnections
+                  << ", \"duration_s\": " << lConfig.mDuration << ", \"keys\": " << lConfig.mKeys
+                  << ", \"key_size\": " << lConfig.mKeySize << ", \"value_size\": " << lConfig.mValueSize
+                  << ", \"reads_percent\": " << lConfig.mReadPercentage
+                  << ", \"distribution\": \"" << (lConfig.mZipf ? "zipf" : "uniform") << "\", \"zipf_theta\": " << lConfig.mZipfTheta
+                  << ", \"pipeline\": " << lConfig.mPipeline << ", \"rate\": " << lConfig.mRate << "},\n"
+                  << " \"requests\": " << lAll.Count() << ", \"errors\": " << lErrors
+                  << ", \"throughput_ops\": " << static_cast<double>(lAll.Count()) / lConfig.mDuration << ",\n"
+                  << " \"latency_us\": {\"all\": ";
+        WriteLatencies(std::cout, lAll);
+        std::cout << ",\n  \"get\": ";
+        WriteLatencies(std::cout, lGet);
+        std::cout << ",\n  \"set\": ";
+        WriteLatencies(std::cout, lSet);
+        std::cout << "}}\n";
+    }
+    catch(const std::exception& aError)
+    {
+        std::cerr << "bench: " << aError.what() << "\n";
+        return 1;
+    }
+
+    google::protobuf::ShutdownProtobufLibrary();
+    return 0;
+}
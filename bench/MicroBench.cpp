@@ -0,0 +1,188 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include "InMemoryDB.h"
+#include "Protocol.h"
+#include "format.pb.h"
+
+// Micro benchmarks of the layers a request passes through, to tell which one an end-to-end
+// regression comes from: the storage engine, frame header decoding, protobuf encoding and
+// reply assembly. No network involved.
+//
+// Usage: micro_bench [--benchmark_filter=<regex>] [other Google Benchmark flags]
+
+namespace
+{
+
+constexpr std::size_t gMaxKeys {1'000'000};
+
+const std::vector<std::string>& Keys()
+{
+    static const std::vector<std::string> lKeys = [](){
+        std::vector<std::string> lResult;
+        lResult.reserve(gMaxKeys);
+        for(std::size_t i = 0; i < gMaxKeys; ++i)
+        {
+            lResult.push_back("key:" + std::to_string(i));
+        }
+        return lResult;
+    }();
+    return lKeys;
+}
+
+// One store per table size, filled with 64 byte values on first use and shared by all threads
+// and benchmarks of that size.
+InMemoryDB& FilledDB(std::size_t aNrOfKeys)
+{
+    static std::mutex lMutex;
+    static std::map<std::size_t, std::unique_ptr<InMemoryDB>> lStores;
+    std::lock_guard lLock{lMutex};
+    std::unique_ptr<InMemoryDB>& lDB = lStores[aNrOfKeys];
+    if(lDB == nullptr)
+    {
+        lDB = std::make_unique<InMemoryDB>();
+        const std::string lValue(64, 'v');
+        for(std::size_t i = 0; i < aNrOfKeys; ++i)
+        {
+            lDB->SetRequest(Keys()[i], std::string_view(lValue));
+        }
+    }
+    return *lDB;
+}
+
+void BM_GetRequest(benchmark::State& aState)
+{
+    const auto lNrOfKeys = static_cast<std::size_t>(aState.range(0));
+    InMemoryDB& lDB = FilledDB(lNrOfKeys);
+    const std::vector<std::string>& lKeys = Keys();
+    std::mt19937_64 lRandom {static_cast<uint64_t>(aState.thread_index()) + 1};
+    for(auto _ : aState)
+    {
+        benchmark::DoNotOptimize(lDB.GetRequest(lKeys[lRandom() % lNrOfKeys]));
+    }
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_GetRequest)->Arg(1'000)->Arg(100'000)->Arg(gMaxKeys)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_SetRequest(benchmark::State& aState)
+{
+    const auto lNrOfKeys = static_cast<std::size_t>(aState.range(0));
+    InMemoryDB& lDB = FilledDB(lNrOfKeys);
+    const std::vector<std::string>& lKeys = Keys();
+    const std::string lValue(64, 'w');
+    std::mt19937_64 lRandom {static_cast<uint64_t>(aState.thread_index()) + 1};
+    for(auto _ : aState)
+    {
+        benchmark::DoNotOptimize(lDB.SetRequest(lKeys[lRandom() % lNrOfKeys], std::string_view(lValue)));
+    }
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_SetRequest)->Arg(1'000)->Arg(100'000)->Arg(gMaxKeys)->ThreadRange(1, 8)->UseRealTime();
+
+// The ASCII header is what the original ConvertTo<uint32_t> parsed; the binary one replaced it.
+template<ProtocolVersion Version>
+void BM_DecodeLength(benchmark::State& aState)
+{
+    char lHeader[gMsgHeaderLength];
+    EncodeLength(Version, 123'456, lHeader);
+    for(auto _ : aState)
+    {
+        benchmark::DoNotOptimize(lHeader);
+        benchmark::DoNotOptimize(DecodeLength(Version, lHeader));
+    }
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK_TEMPLATE(BM_DecodeLength, ProtocolVersion::ASCII_V1);
+BENCHMARK_TEMPLATE(BM_DecodeLength, ProtocolVersion::BINARY_V2);
+
+void BM_PayloadSerialize(benchmark::State& aState)
+{
+    pkg::Payload lPayload;
+    lPayload.set_key("key:123456");
+    lPayload.set_value(std::string(static_cast<std::size_t>(aState.range(0)), 'v'));
+    std::string lBytes;
+    for(auto _ : aState)
+    {
+        lPayload.SerializeToString(&lBytes);
+        benchmark::DoNotOptimize(lBytes.data());
+    }
+    aState.SetBytesProcessed(aState.iterations() * static_cast<int64_t>(lBytes.size()));
+}
+BENCHMARK(BM_PayloadSerialize)->RangeMultiplier(32)->Range(16, 64 << 10);
+
+void BM_PayloadParse(benchmark::State& aState)
+{
+    pkg::Payload lPayload;
+    lPayload.set_key("key:123456");
+    lPayload.set_value(std::string(static_cast<std::size_t>(aState.range(0)), 'v'));
+    const std::string lBytes = lPayload.SerializeAsString();
+    for(auto _ : aState)
+    {
+        benchmark::DoNotOptimize(lPayload.ParseFromArray(lBytes.data(), static_cast<int>(lBytes.size())));
+    }
+    aState.SetBytesProcessed(aState.iterations() * static_cast<int64_t>(lBytes.size()));
+}
+BENCHMARK(BM_PayloadParse)->RangeMultiplier(32)->Range(16, 64 << 10);
+
+// What the server does per request: parse into a reused pkg::Request.
+void BM_RequestParse(benchmark::State& aState)
+{
+    pkg::Request lRequest;
+    lRequest.set_op(pkg::OP_SET);
+    lRequest.set_id(42);
+    lRequest.set_key("key:123456");
+    lRequest.set_value(std::string(static_cast<std::size_t>(aState.range(0)), 'v'));
+    const std::string lBytes = lRequest.SerializeAsString();
+    for(auto _ : aState)
+    {
+        benchmark::DoNotOptimize(lRequest.ParseFromArray(lBytes.data(), static_cast<int>(lBytes.size())));
+    }
+    aState.SetBytesProcessed(aState.iterations() * static_cast<int64_t>(lBytes.size()));
+}
+BENCHMARK(BM_RequestParse)->RangeMultiplier(32)->Range(16, 64 << 10);
+
+// A GET reply assembled the way the server does: framed envelope, hand encoded value field
+// and the value referenced, then gathered into write buffers.
+void BM_ReplyGet(benchmark::State& aState)
+{
+    SlabArena lArena;
+    const std::string lBytes(static_cast<std::size_t>(aState.range(0)), 'v');
+    const ValueRef lValue {Value::Create(lArena, std::string_view(lBytes))};
+    pkg::Response lResponse;
+    ResponseBuffer lResponses;
+    std::vector<std::pair<const char*, std::size_t>> lWriteBuffers;
+    for(auto _ : aState)
+    {
+        lResponse.Clear();
+        lResponse.set_id(42);
+        lResponse.set_status(pkg::STATUS_OK);
+        const std::size_t lEnvelopeLength = lResponse.ByteSizeLong();
+        char lValueField[1 + gMaxVarintLength];
+        lValueField[0] = static_cast<char>((pkg::Response::kValueFieldNumber << 3) | 2);
+        const std::size_t lValueFieldLength = 1 + EncodeVarint(lValue->Size(), lValueField + 1);
+
+        const std::size_t lTotalLength = lEnvelopeLength + lValueFieldLength + lValue->Size();
+        EncodeLength(ProtocolVersion::BINARY_V2, static_cast<uint32_t>(lTotalLength), lResponses.AppendSpace(gBinaryHeaderLength));
+        lResponse.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(lResponses.AppendSpace(lEnvelopeLength)));
+        lResponses.Append(std::string_view(lValueField, lValueFieldLength));
+        lResponses.Append(lValue);
+
+        lWriteBuffers.clear();
+        lResponses.ForEachSegment([&lWriteBuffers](const char* aData, std::size_t aLength){
+            lWriteBuffers.emplace_back(aData, aLength);
+        });
+        benchmark::DoNotOptimize(lWriteBuffers.data());
+        lResponses.Clear();
+    }
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_ReplyGet)->RangeMultiplier(32)->Range(16, 64 << 10);
+
+}
+
+BENCHMARK_MAIN();
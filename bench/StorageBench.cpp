@@ -0,0 +1,124 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include "InMemoryDB.h"
+
+// Measures InMemoryDB throughput for 1..N threads on a random GET/SET mix, once with a single
+// shard (equivalent to one global lock) and once with the default shard count.
+//
+// Usage: storage_bench [max threads] [ops per thread] [nr of keys] [read percentage]
+
+namespace
+{
+
+struct BenchConfig
+{
+    uint32_t mMaxThreads {std::max(1u, std::thread::hardware_concurrency())};
+    uint64_t mOpsPerThread {1'000'000};
+    uint32_t mNrOfKeys {100'000};
+    uint32_t mReadPercentage {90};
+};
+
+std::vector<std::string> MakeKeys(uint32_t aNrOfKeys)
+{
+    std::vector<std::string> lKeys;
+    lKeys.reserve(aNrOfKeys);
+    for(uint32_t i = 0; i < aNrOfKeys; ++i)
+    {
+        lKeys.push_back("key:" + std::to_string(i));
+    }
+    return lKeys;
+}
+
+double RunOnce(InMemoryDB& aDB, const std::vector<std::string>& aKeys, const BenchConfig& aConfig, uint32_t aNrOfThreads)
+{
+    const std::string lValue(64, 'v');
+    std::atomic<bool> lStart {false};
+    std::vector<std::thread> lThreads;
+
+    for(uint32_t t = 0; t < aNrOfThreads; ++t)
+    {
+        lThreads.emplace_back([&, t](){
+            std::mt19937_64 lRandom {t + 1};
+            std::uniform_int_distribution<uint32_t> lKeyDist {0, static_cast<uint32_t>(aKeys.size() - 1)};
+            std::uniform_int_distribution<uint32_t> lOpDist {0, 99};
+            std::size_t lHits {0};
+
+            while(lStart.load(std::memory_order_acquire) == false)
+            {
+                std::this_thread::yield();
+            }
+
+            for(uint64_t i = 0; i < aConfig.mOpsPerThread; ++i)
+            {
+                const std::string& lKey = aKeys[lKeyDist(lRandom)];
+                if(lOpDist(lRandom) < aConfig.mReadPercentage)
+                {
+                    lHits += aDB.GetRequest(lKey) != nullptr;
+                }
+                else
+                {
+                    aDB.SetRequest(lKey, lValue);
+                }
+            }
+
+            // Keeps the reads from being optimised away.
+            if(lHits == static_cast<std::size_t>(-1))
+            {
+                std::cout << lHits;
+            }
+        });
+    }
+
+    const auto lBegin = std::chrono::steady_clock::now();
+    lStart.store(true, std::memory_order_release);
+    for(auto& thread : lThreads)
+    {
+        thread.join();
+    }
+    const std::chrono::duration<double> lElapsed = std::chrono::steady_clock::now() - lBegin;
+
+    return static_cast<double>(aConfig.mOpsPerThread * aNrOfThreads) / lElapsed.count();
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    BenchConfig lConfig {};
+    if(argc > 1) lConfig.mMaxThreads = std::max(1, std::atoi(argv[1]));
+    if(argc > 2) lConfig.mOpsPerThread = std::max(1ll, std::atoll(argv[2]));
+    if(argc > 3) lConfig.mNrOfKeys = std::max(1, std::atoi(argv[3]));
+    if(argc > 4) lConfig.mReadPercentage = std::min(100, std::max(0, std::atoi(argv[4])));
+
+    const std::vector<std::string> lKeys = MakeKeys(lConfig.mNrOfKeys);
+    const std::string lValue(64, 'v');
+
+    InMemoryDB lSingleShardDB {1};
+    InMemoryDB lShardedDB {};
+    for(const auto& lKey : lKeys)
+    {
+        lSingleShardDB.SetRequest(lKey, lValue);
+        lShardedDB.SetRequest(lKey, lValue);
+    }
+
+    std::cout << "keys=" << lConfig.mNrOfKeys << " reads=" << lConfig.mReadPercentage << "% ops/thread=" << lConfig.mOpsPerThread
+              << " shards=" << lShardedDB.NrOfShards() << "\n";
+    std::cout << std::setw(8) << "threads" << std::setw(18) << "1 shard ops/s" << std::setw(18) << "sharded ops/s" << "\n";
+
+    for(uint32_t lThreads = 1; lThreads <= lConfig.mMaxThreads; lThreads *= 2)
+    {
+        const double lSingle = RunOnce(lSingleShardDB, lKeys, lConfig, lThreads);
+        const double lSharded = RunOnce(lShardedDB, lKeys, lConfig, lThreads);
+        std::cout << std::setw(8) << lThreads << std::fixed << std::setprecision(0)
+                  << std::setw(18) << lSingle << std::setw(18) << lSharded << "\n";
+    }
+
+    return 0;
+}
@@ -1,59 +1,145 @@
 #include <boost/asio.hpp>
-#include <sstream>
-#include <ranges>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <tuple>
 #include "format.pb.h"
+#include "Protocol.h"
 
 using boost::asio::ip::tcp;
 
-std::string encodeLength(const std::string& aData)
-{    
-    std::string lMsgLength = std::to_string(aData.size());
-    const int lNrOfDigits = lMsgLength.size();
-    std::string lResult {"00000000"};
+std::string encodeLength(const std::string& aData, ProtocolVersion aVersion)
+{
+    std::string lResult = EncodeFrame(aData, aVersion);
+    std::cout << "Frame: " << aData.size() << " bytes payload, " << HeaderLength(aVersion) << " bytes header" << std::endl;
+    return lResult;
+}
 
-    int idx = lNrOfDigits - 1;
-    for(auto& e : lResult | std::views::reverse)
+std::string readResponse(tcp::socket& aSocket, ProtocolVersion aVersion)
+{
+    char lHeader[gMsgHeaderLength];
+    boost::asio::read(aSocket, boost::asio::buffer(lHeader, HeaderLength(aVersion)));
+
+    std::optional<uint32_t> lLength = DecodeLength(aVersion, lHeader);
+    if(lLength.has_value() == false)
     {
-        if(idx < 0)
-        {
-            break;
-        }
-        e = lMsgLength[idx--];
+        throw std::runtime_error("Invalid response header");
     }
-    
-    std::cout << "Header: " << lResult << std::endl;
 
-    return lResult + aData;
+    std::string lResponse(lLength.value(), '\0');
+    boost::asio::read(aSocket, boost::asio::buffer(lResponse));
+    return lResponse;
 }
 
 int main(int argc, char* argv[])
 {
     using boost::asio::ip::tcp;
     boost::asio::io_context io_context;
-    
+
     // we need a socket and a resolver
     tcp::socket socket(io_context);
     tcp::resolver resolver(io_context);
     boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::address::from_string("127.0.0.1"), 12345);
-    
+
     // now we can use connect(..)
     socket.connect(endpoint);
 
-    // and use write(..) to send some data which is here just a string
-    pkg::Payload lPayload {};
-    lPayload.set_key("Hello");
-    lPayload.set_value("World");
-    std::string lData = lPayload.SerializeAsString();
-    socket.write_some(boost::asio::buffer(encodeLength(lData)));
-    // auto result = boost::asio::write(socket, boost::asio::buffer(lData));
-    
+    // the binary length prefix is negotiated with a preamble, --legacy keeps the ASCII header
+    const bool lLegacy = argc > 1 && std::string(argv[1]) == "--legacy";
+    const ProtocolVersion lVersion = lLegacy ? ProtocolVersion::ASCII_V1 : ProtocolVersion::BINARY_V2;
+    if(lVersion == ProtocolVersion::BINARY_V2)
+    {
+        boost::asio::write(socket, boost::asio::buffer(gProtocolPreamble));
+        char lAck[gProtocolPreambleLength];
+        boost::asio::read(socket, boost::asio::buffer(lAck));
+        if(IsProtocolPreamble(lAck) == false)
+        {
+            std::cerr << "Server does not support the binary protocol" << std::endl;
+            return 1;
+        }
+    }
+
+    // a SET followed by a few reads, all pipelined on the same connection
+    std::vector<std::tuple<pkg::Op, std::string, std::string>> lRequests {
+        {pkg::OP_SET, "Hello", "World"}, {pkg::OP_GET, "Hello", ""}, {pkg::OP_EXISTS, "Hello", ""},
+        {pkg::OP_DEL, "Hello", ""}, {pkg::OP_GET, "Hello", ""}};
+    std::string lData {};
+    for(std::size_t i = 0; i < lRequests.size(); ++i)
+    {
+        const auto& [lOp, lKey, lValue] = lRequests[i];
+        if(lLegacy)
+        {
+            // legacy payloads only know GET (empty value) and SET
+            pkg::Payload lPayload {};
+            lPayload.set_key(lKey);
+            lPayload.set_value(lValue);
+            lData += encodeLength(lPayload.SerializeAsString(), lVersion);
+            continue;
+        }
+
+        pkg::Request lRequest {};
+        lRequest.set_op(lOp);
+        lRequest.set_id(i);
+        lRequest.set_version(1);
+        lRequest.set_key(lKey);
+        lRequest.set_value(lValue);
+        lData += encodeLength(lRequest.SerializeAsString(), lVersion);
+    }
+
+    // a batch write and a batch read of several keys, one frame each
+    std::size_t lNrOfRequests = lRequests.size();
+    if(lLegacy == false)
+    {
+        for(const pkg::Op lOp : {pkg::OP_MSET, pkg::OP_MGET})
+        {
+            pkg::Request lRequest {};
+            lRequest.set_op(lOp);
+            lRequest.set_id(lNrOfRequests++);
+            lRequest.set_version(1);
+            for(const std::string lKey : {"k1", "k2", "k3"})
+            {
+                pkg::KeyValue* lEntry = lRequest.add_entries();
+                lEntry->set_key(lKey);
+                if(lOp == pkg::OP_MSET && lKey != "k3")
+                {
+                    lEntry->set_value(lKey == "k1" ? std::string(4096, 'x') : "v2");
+                }
+            }
+            if(lOp == pkg::OP_MSET)
+            {
+                lRequest.mutable_entries()->RemoveLast();
+            }
+            lData += encodeLength(lRequest.SerializeAsString(), lVersion);
+        }
+    }
+    boost::asio::write(socket, boost::asio::buffer(lData));
+
     // the result represents the size of the sent data
     std::cout << "data sent: " << lData.length() << std::endl;
 
+    // replies come back in request order
+    for(std::size_t i = 0; i < lNrOfRequests; ++i)
+    {
+        if(lLegacy)
+        {
+            std::cout << "response: " << readResponse(socket, lVersion) << std::endl;
+            continue;
+        }
+
+        pkg::Response lResponse {};
+        lResponse.ParseFromString(readResponse(socket, lVersion));
+        std::cout << "response " << lResponse.id() << ": " << pkg::Status_Name(lResponse.status())
+                  << " value=" << lResponse.value() << " found=" << lResponse.found() << " " << lResponse.message() << std::endl;
+        for(const auto& lResult : lResponse.results())
+        {
+            std::cout << "    " << pkg::Status_Name(lResult.status()) << " value size=" << lResult.value().size() << std::endl;
+        }
+    }
+
     // and close the connection now
     boost::system::error_code ec;
     socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
     socket.close();
 
     return 0;
-}
\ No newline at end of file
+}
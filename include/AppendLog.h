@@ -0,0 +1,475 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <charconv>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <filesystem>
+#include <optional>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include "LogRecord.h"
+#include "MappedFile.h"
+#include "Logger.h"
+#include "Value.h"
+
+// Append-only log of the writes to the store, replayed on startup.
+//
+// Request threads only queue records: each goes to one of a fixed set of stripes, picked by the
+// caller from the key, behind a lock that is only shared with the writes of the same stripe. A
+// dedicated writer thread collects every stripe once per group commit window, encodes the batch
+// and writes it with a single write call, then fsyncs according to the policy:
+//  - ALWAYS  : after every batch,
+//  - INTERVAL: at most once per interval,
+//  - NEVER   : left to the operating system.
+// Replies are not held back until the batch is on disk, so a crash can lose up to a window of
+// acknowledged writes (plus the fsync interval).
+// A batch that fails to write is dropped and the file cut back to the end of the batch before,
+// so that later batches are not appended after a torn record, where replay would stop. When
+// the file cannot be cut back the log is marked failed and no longer written (see Failed).
+
+enum class FsyncPolicy : uint8_t
+{
+    ALWAYS,
+    INTERVAL,
+    NEVER
+};
+
+// "always", "never", or the number of milliseconds between fsyncs.
+inline bool ParseFsyncPolicy(std::string_view aText, FsyncPolicy& aPolicy, std::chrono::milliseconds& aInterval)
+{
+    if(aText == "always" || aText == "never")
+    {
+        aPolicy = aText == "always" ? FsyncPolicy::ALWAYS : FsyncPolicy::NEVER;
+        return true;
+    }
+
+    uint32_t lMs {0};
+    auto [lPtr, lError] = std::from_chars(aText.data(), aText.data() + aText.size(), lMs);
+    if(lError != std::errc{} || lPtr != aText.data() + aText.size() || lMs == 0)
+    {
+        return false;
+    }
+    aPolicy = FsyncPolicy::INTERVAL;
+    aInterval = std::chrono::milliseconds{lMs};
+    return true;
+}
+
+class AppendLog
+{
+    static constexpr std::size_t mNrOfStripes {64};
+    static constexpr std::chrono::milliseconds mGroupCommitWindow {2};
+    // A batch is written out once it reaches this size, bounding the writer's buffer.
+    static constexpr std::size_t mMaxBatchLength {4u << 20};
+    static constexpr char mMagic[8] {'I', 'M', 'D', 'A', 'O', 'F', '1', '\n'};
+
+public:
+    using ValueHandle = ValueRef;
+
+    // Opens aPath for appending. The file is cut to aValidLength, as returned by Replay, so a
+    // record torn by a crash is not followed by new ones.
+    AppendLog(const std::string& aPath, std::size_t aValidLength, FsyncPolicy aPolicy, std::chrono::milliseconds aFsyncInterval)
+        : mPath{aPath}, mPolicy{aPolicy}, mFsyncInterval{aFsyncInterval}, mStripes{std::make_unique<Stripe[]>(mNrOfStripes)}
+    {
+        mFd = Open(aValidLength);
+        for(const std::string& lRotated : RotatedFiles(aPath))
+        {
+            mNextRotation = std::max(mNextRotation, RotationNumber(aPath, lRotated).value() + 1);
+        }
+        mWriter = std::thread([this](){ Run(); });
+    }
+
+    AppendLog(const AppendLog&) = delete;
+    AppendLog& operator=(const AppendLog&) = delete;
+
+    // Writes out and syncs everything queued before returning.
+    ~AppendLog()
+    {
+        mRunning.store(false);
+        if(mWriter.joinable())
+        {
+            mWriter.join();
+        }
+        ::close(mFd);
+    }
+
+    // Queue a record; aStripe must be the same for every write of a key, so the records of one
+    // key keep their order. Never touches the disk.
+    void Set(std::size_t aStripe, std::string_view aKey, ValueHandle aValue, uint64_t aExpireAt)
+    {
+        LogOp lOp {LogOp::SET};
+        if(aValue->GetCodec() == Codec::LZ4)
+        {
+            lOp = LogOp::SET_LZ4;
+        }
+        else if(aValue->GetCodec() == Codec::INT64)
+        {
+            lOp = LogOp::SET_INT64;
+        }
+        Append(aStripe, {lOp, std::string(aKey), std::move(aValue), aExpireAt});
+    }
+
+    void Del(std::size_t aStripe, std::string_view aKey)
+    {
+        Append(aStripe, {LogOp::DEL, std::string(aKey), nullptr, 0});
+    }
+
+    void Expire(std::size_t aStripe, std::string_view aKey, uint64_t aExpireAt)
+    {
+        Append(aStripe, {LogOp::EXPIRE, std::string(aKey), nullptr, aExpireAt});
+    }
+
+    // Moves the log written so far aside, to aPath.<n>, and continues in a fresh aPath. Every
+    // record queued before the call is in the rotated file, which is synced before returning,
+    // so a snapshot started afterwards covers it and it can be deleted once the snapshot is
+    // durable. Returns the path of the rotated file.
+    std::string Rotate()
+    {
+        std::lock_guard lLock{mFileMutex};
+        WriteQueued();
+        Sync();
+
+        std::string lRotated = mPath + "." + std::to_string(mNextRotation);
+        if(::rename(mPath.c_str(), lRotated.c_str()) != 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "rename " + mPath);
+        }
+        ++mNextRotation;
+
+        const int lFd = Open(0);
+        ::close(mFd);
+        mFd = lFd;
+        SyncDirectory(mPath);
+        return lRotated;
+    }
+
+    // Rotated files left by snapshots that did not complete, oldest first. They are replayed
+    // before aPath itself.
+    static std::vector<std::string> RotatedFiles(const std::string& aPath)
+    {
+        std::vector<std::pair<uint64_t, std::string>> lFiles;
+        const std::filesystem::path lPath {aPath};
+        const std::filesystem::path lDirectory = lPath.parent_path().empty() ? std::filesystem::path(".") : lPath.parent_path();
+        std::error_code lError;
+        for(const auto& lEntry : std::filesystem::directory_iterator(lDirectory, lError))
+        {
+            const std::string lFile = (lPath.parent_path() / lEntry.path().filename()).string();
+            if(std::optional<uint64_t> lNumber = RotationNumber(aPath, lFile))
+            {
+                lFiles.emplace_back(*lNumber, lFile);
+            }
+        }
+        std::sort(lFiles.begin(), lFiles.end());
+
+        std::vector<std::string> lResult;
+        for(auto& [lNumber, lFile] : lFiles)
+        {
+            lResult.push_back(std::move(lFile));
+        }
+        return lResult;
+    }
+
+    const std::string& Path() const
+    {
+        return mPath;
+    }
+
+    uint64_t WriteErrors() const
+    {
+        return mWriteErrors.load(std::memory_order_relaxed);
+    }
+
+    // Whether writing stopped after an error that left a torn record in the file.
+    bool Failed() const
+    {
+        return mFailed.load(std::memory_order_relaxed);
+    }
+
+    // Replays aPath on aNrOfThreads threads. aApply(const LogRecord&) is called concurrently,
+    // but the records of one key are applied by one thread, in log order. The file is mapped
+    // and walked once to find the record boundaries; the records are then checked and decoded
+    // in parallel slices, each thread sorting its slice into per thread lanes by key hash, and
+    // finally every thread applies its lane of every slice in slice order.
+    // Replay stops at the first torn or corrupt record. Returns the length of the valid prefix.
+    template<typename Apply>
+    static std::size_t Replay(const std::string& aPath, std::size_t aNrOfThreads, Apply&& aApply)
+    {
+        MappedFile lFile(aPath);
+        const std::string_view lData = lFile.Data();
+        if(lData.empty())
+        {
+            return 0;
+        }
+        if(lData.size() < sizeof(mMagic) || lData.substr(0, sizeof(mMagic)) != std::string_view(mMagic, sizeof(mMagic)))
+        {
+            throw std::runtime_error(aPath + " is not an append-only log");
+        }
+
+        std::vector<std::size_t> lOffsets;
+        std::size_t lPosition {sizeof(mMagic)};
+        while(lData.size() - lPosition >= gLogRecordHeaderLength)
+        {
+            const std::size_t lLength = GetFixed<uint32_t>(lData.data() + lPosition);
+            if(lData.size() - lPosition - gLogRecordHeaderLength < lLength)
+            {
+                break;
+            }
+            lOffsets.push_back(lPosition);
+            lPosition += gLogRecordHeaderLength + lLength;
+        }
+
+        struct Slot
+        {
+            std::size_t mIndex;
+            LogRecord mRecord;
+        };
+
+        const std::size_t lNrOfThreads = std::clamp<std::size_t>(aNrOfThreads, 1, std::max<std::size_t>(1, lOffsets.size() / 1024));
+        std::vector<std::vector<std::vector<Slot>>> lLanes(lNrOfThreads, std::vector<std::vector<Slot>>(lNrOfThreads));
+        std::atomic<std::size_t> lFirstBad {lOffsets.size()};
+
+        RunParallel(lNrOfThreads, [&](std::size_t aThread){
+            const std::size_t lBegin = lOffsets.size() * aThread / lNrOfThreads;
+            const std::size_t lEnd = lOffsets.size() * (aThread + 1) / lNrOfThreads;
+            for(std::size_t i = lBegin; i < lEnd; ++i)
+            {
+                const char* lHeader = lData.data() + lOffsets[i];
+                const std::string_view lBody {lHeader + gLogRecordHeaderLength, GetFixed<uint32_t>(lHeader)};
+                std::optional<LogRecord> lRecord;
+                if(Crc32c(lBody.data(), lBody.size()) == GetFixed<uint32_t>(lHeader + 4))
+                {
+                    lRecord = DecodeLogRecord(lBody);
+                }
+                if(lRecord.has_value() == false)
+                {
+                    std::size_t lBad = lFirstBad.load();
+                    while(i < lBad && lFirstBad.compare_exchange_weak(lBad, i) == false)
+                    {
+                    }
+                    return;
+                }
+                const std::size_t lLane = std::hash<std::string_view>{}(lRecord->mKey) % lNrOfThreads;
+                lLanes[aThread][lLane].push_back({i, *lRecord});
+            }
+        });
+
+        const std::size_t lValid = lFirstBad.load();
+        RunParallel(lNrOfThreads, [&](std::size_t aLane){
+            for(std::size_t lSlice = 0; lSlice < lNrOfThreads; ++lSlice)
+            {
+                for(const Slot& lSlot : lLanes[lSlice][aLane])
+                {
+                    if(lSlot.mIndex >= lValid)
+                    {
+                        return;
+                    }
+                    aApply(lSlot.mRecord);
+                }
+            }
+        });
+
+        const std::size_t lValidLength = lValid < lOffsets.size() ? lOffsets[lValid] : lPosition;
+        if(lValidLength < lData.size())
+        {
+            LOG_WARNING("Ignoring ", lData.size() - lValidLength, " bytes of torn or corrupt records at the end of ", aPath);
+        }
+        LOG_INFO("Replayed ", lValid, " records from ", aPath, " on ", lNrOfThreads, " threads");
+        return lValidLength;
+    }
+
+private:
+    // Opens mPath for appending, cut to aValidLength; starts it over when that is not past the
+    // file header.
+    int Open(std::size_t aValidLength)
+    {
+        const int lFd = ::open(mPath.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+        if(lFd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "open " + mPath);
+        }
+
+        const bool lFresh = aValidLength < sizeof(mMagic);
+        if(::ftruncate(lFd, lFresh ? 0 : static_cast<off_t>(aValidLength)) != 0 ||
+           ::lseek(lFd, 0, SEEK_END) < 0 ||
+           (lFresh && WriteAll(lFd, std::string_view(mMagic, sizeof(mMagic))) == false))
+        {
+            const int lError = errno;
+            ::close(lFd);
+            throw std::system_error(lError, std::generic_category(), "prepare " + mPath);
+        }
+        mLength = lFresh ? sizeof(mMagic) : aValidLength;
+        return lFd;
+    }
+
+    struct PendingRecord
+    {
+        LogOp mOp;
+        std::string mKey;
+        ValueHandle mValue;
+        uint64_t mExpireAt;
+    };
+
+    struct alignas(64) Stripe
+    {
+        std::mutex mMutex;
+        std::vector<PendingRecord> mPending;
+    };
+
+    template<typename Task>
+    static void RunParallel(std::size_t aNrOfThreads, Task&& aTask)
+    {
+        std::vector<std::thread> lThreads;
+        for(std::size_t i = 1; i < aNrOfThreads; ++i)
+        {
+            lThreads.emplace_back([&aTask, i](){ aTask(i); });
+        }
+        aTask(0);
+        for(std::thread& lThread : lThreads)
+        {
+            lThread.join();
+        }
+    }
+
+    void Append(std::size_t aStripe, PendingRecord aRecord)
+    {
+        Stripe& lStripe = mStripes[aStripe % mNrOfStripes];
+        std::lock_guard lLock{lStripe.mMutex};
+        lStripe.mPending.push_back(std::move(aRecord));
+    }
+
+    void Run()
+    {
+        auto lLastSync = std::chrono::steady_clock::now();
+        for(;;)
+        {
+            // Read before collecting, so everything queued before shutdown makes the last batch.
+            const bool lRunning = mRunning.load();
+            {
+                std::lock_guard lLock{mFileMutex};
+                WriteQueued();
+
+                const auto lNow = std::chrono::steady_clock::now();
+                const bool lSyncDue = mPolicy == FsyncPolicy::ALWAYS || (mPolicy == FsyncPolicy::INTERVAL && lNow - lLastSync >= mFsyncInterval);
+                if(mDirty && (lSyncDue || lRunning == false))
+                {
+                    Sync();
+                    lLastSync = lNow;
+                }
+            }
+
+            if(lRunning == false)
+            {
+                return;
+            }
+            std::this_thread::sleep_for(mGroupCommitWindow);
+        }
+    }
+
+    // Collects every stripe and writes the records out. Called with mFileMutex held.
+    void WriteQueued()
+    {
+        for(std::size_t i = 0; i < mNrOfStripes; ++i)
+        {
+            {
+                std::lock_guard lLock{mStripes[i].mMutex};
+                mTaken.swap(mStripes[i].mPending);
+            }
+            for(const PendingRecord& lRecord : mTaken)
+            {
+                EncodeLogRecord({lRecord.mOp, lRecord.mKey, lRecord.mValue ? std::string_view(*lRecord.mValue) : std::string_view{}, lRecord.mExpireAt}, mBatch);
+                if(mBatch.size() >= mMaxBatchLength)
+                {
+                    Flush();
+                }
+            }
+            // Values are released here, outside the stripe lock.
+            mTaken.clear();
+        }
+        Flush();
+    }
+
+    void Flush()
+    {
+        if(mBatch.empty())
+        {
+            return;
+        }
+        if(mFailed.load(std::memory_order_relaxed))
+        {
+            mBatch.clear();
+            return;
+        }
+
+        if(WriteAll(mFd, mBatch))
+        {
+            mLength += mBatch.size();
+            mDirty = true;
+        }
+        else
+        {
+            const int lError = errno;
+            mWriteErrors.fetch_add(1, std::memory_order_relaxed);
+            if(::ftruncate(mFd, static_cast<off_t>(mLength)) == 0 && ::lseek(mFd, static_cast<off_t>(mLength), SEEK_SET) >= 0)
+            {
+                LOG_ERROR("Error writing the append-only log, dropped ", mBatch.size(), " bytes of records: ", std::generic_category().message(lError));
+            }
+            else
+            {
+                mFailed.store(true, std::memory_order_relaxed);
+                LOG_ERROR("Error writing the append-only log: ", std::generic_category().message(lError),
+                          ", cutting off the torn batch failed too: ", std::generic_category().message(errno), ", the log is no longer written");
+            }
+        }
+        mBatch.clear();
+    }
+
+    void Sync()
+    {
+        if(::fdatasync(mFd) != 0)
+        {
+            LOG_ERROR("Error syncing the append-only log: ", std::generic_category().message(errno));
+        }
+        mDirty = false;
+    }
+
+    static std::optional<uint64_t> RotationNumber(const std::string& aPath, const std::string& aFile)
+    {
+        if(aFile.size() <= aPath.size() + 1 || aFile.compare(0, aPath.size(), aPath) != 0 || aFile[aPath.size()] != '.')
+        {
+            return std::nullopt;
+        }
+        uint64_t lNumber {0};
+        const char* lEnd = aFile.data() + aFile.size();
+        auto [lPtr, lError] = std::from_chars(aFile.data() + aPath.size() + 1, lEnd, lNumber);
+        return lError == std::errc{} && lPtr == lEnd ? std::optional<uint64_t>{lNumber} : std::nullopt;
+    }
+
+    const std::string mPath;
+    int mFd {-1};
+    // Length of mFd up to the end of the last batch written whole.
+    std::size_t mLength {0};
+    const FsyncPolicy mPolicy;
+    const std::chrono::milliseconds mFsyncInterval;
+    std::unique_ptr<Stripe[]> mStripes;
+    std::atomic<bool> mRunning {true};
+    std::atomic<uint64_t> mWriteErrors {0};
+    std::atomic<bool> mFailed {false};
+    // Held by whoever writes to mFd: the writer thread for a batch, Rotate for the switch.
+    std::mutex mFileMutex;
+    std::vector<PendingRecord> mTaken;
+    std::string mBatch;
+    bool mDirty {false};
+    uint64_t mNextRotation {1};
+    std::thread mWriter;
+};
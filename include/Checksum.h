@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define INMEMORYDB_CRC32C_HW 1
+#endif
+
+// CRC-32C (Castagnoli) of the records written to disk. Uses the SSE4.2 crc32 instruction when
+// the CPU has it, whatever flags the binary was built with, and a table otherwise.
+
+namespace checksum_detail
+{
+    inline constexpr std::array<uint32_t, 256> gCrc32cTable = []{
+        std::array<uint32_t, 256> lTable {};
+        for(uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t lCrc = i;
+            for(int lBit = 0; lBit < 8; ++lBit)
+            {
+                lCrc = (lCrc >> 1) ^ (0x82F63B78u & (0u - (lCrc & 1)));
+            }
+            lTable[i] = lCrc;
+        }
+        return lTable;
+    }();
+
+    inline uint32_t Crc32cTable(uint32_t aCrc, const unsigned char* aData, std::size_t aLength)
+    {
+        for(std::size_t i = 0; i < aLength; ++i)
+        {
+            aCrc = gCrc32cTable[(aCrc ^ aData[i]) & 0xFF] ^ (aCrc >> 8);
+        }
+        return aCrc;
+    }
+
+#ifdef INMEMORYDB_CRC32C_HW
+    __attribute__((target("sse4.2")))
+    inline uint32_t Crc32cHardware(uint32_t aCrc, const unsigned char* aData, std::size_t aLength)
+    {
+        uint64_t lCrc {aCrc};
+        for(; aLength >= 8; aData += 8, aLength -= 8)
+        {
+            uint64_t lWord;
+            std::memcpy(&lWord, aData, sizeof(lWord));
+            lCrc = _mm_crc32_u64(lCrc, lWord);
+        }
+        aCrc = static_cast<uint32_t>(lCrc);
+        for(; aLength > 0; ++aData, --aLength)
+        {
+            aCrc = _mm_crc32_u8(aCrc, *aData);
+        }
+        return aCrc;
+    }
+#endif
+}
+
+// aCrc continues a previous checksum, so a record can be checked in pieces.
+inline uint32_t Crc32c(const void* aData, std::size_t aLength, uint32_t aCrc = 0)
+{
+    const auto* lData = static_cast<const unsigned char*>(aData);
+#ifdef INMEMORYDB_CRC32C_HW
+    static const bool lHardware = __builtin_cpu_supports("sse4.2");
+    if(lHardware)
+    {
+        return ~checksum_detail::Crc32cHardware(~aCrc, lData, aLength);
+    }
+#endif
+    return ~checksum_detail::Crc32cTable(~aCrc, lData, aLength);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <string_view>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+// Key storage of the engine, 24 bytes against std::string's 32. Keys of up to mInlineCapacity
+// bytes, which covers most real key schemes, are kept in place; longer ones take one heap
+// block of exactly their size.
+class CompactKey
+{
+public:
+    static constexpr std::size_t mInlineCapacity {22};
+
+    explicit CompactKey(std::string_view aKey)
+    {
+        if(aKey.size() <= mInlineCapacity)
+        {
+            std::memcpy(mBytes, aKey.data(), aKey.size());
+            mBytes[mTagIndex] = static_cast<char>(aKey.size());
+            return;
+        }
+
+        char* lHeap = new char[aKey.size()];
+        std::memcpy(lHeap, aKey.data(), aKey.size());
+        const uint64_t lSize {aKey.size()};
+        std::memcpy(mBytes, &lHeap, sizeof(lHeap));
+        std::memcpy(mBytes + sizeof(lHeap), &lSize, sizeof(lSize));
+        mBytes[mTagIndex] = mHeapTag;
+    }
+
+    CompactKey(const CompactKey& aOther) : CompactKey(aOther.View()) {}
+
+    CompactKey(CompactKey&& aOther) noexcept
+    {
+        std::memcpy(mBytes, aOther.mBytes, sizeof(mBytes));
+        aOther.mBytes[mTagIndex] = 0;
+    }
+
+    CompactKey& operator=(const CompactKey&) = delete;
+
+    ~CompactKey()
+    {
+        if(IsHeap())
+        {
+            delete[] HeapData();
+        }
+    }
+
+    std::string_view View() const
+    {
+        if(IsHeap())
+        {
+            uint64_t lSize;
+            std::memcpy(&lSize, mBytes + sizeof(char*), sizeof(lSize));
+            return {HeapData(), static_cast<std::size_t>(lSize)};
+        }
+        return {mBytes, static_cast<std::size_t>(mBytes[mTagIndex])};
+    }
+
+    operator std::string_view() const
+    {
+        return View();
+    }
+
+    friend bool operator==(const CompactKey& aLeft, std::string_view aRight)
+    {
+        return aLeft.View() == aRight;
+    }
+
+    friend bool operator==(const CompactKey& aLeft, const CompactKey& aRight)
+    {
+        return aLeft.View() == aRight.View();
+    }
+
+private:
+    static constexpr std::size_t mTagIndex {23};
+    static constexpr char mHeapTag {static_cast<char>(0xFF)};
+
+    bool IsHeap() const
+    {
+        return mBytes[mTagIndex] == mHeapTag;
+    }
+
+    char* HeapData() const
+    {
+        char* lHeap;
+        std::memcpy(&lHeap, mBytes, sizeof(lHeap));
+        return lHeap;
+    }
+
+    // Inline: the key followed by its length in the last byte. Heap: pointer, size, tag.
+    char mBytes[24];
+};
+
+static_assert(sizeof(CompactKey) == 24);
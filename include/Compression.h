@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Value codecs. An entry records the codec its bytes are stored with; NONE and LZ4 match
+// pkg::Codec on the wire. INT64 is an integer kept natively by INCRBY, 8 bytes little-endian;
+// it never goes on the wire, clients get its decimal digits.
+enum class Codec : uint8_t
+{
+    NONE = 0,
+    LZ4 = 1,
+    INT64 = 2
+};
+
+// LZ4 block format (lz4_Block_format.md of the reference implementation), compressed greedily
+// with a single hash probe per position like its fast mode. A stored LZ4 value is
+//   u32 little-endian uncompressed length | LZ4 block
+// which is the "size prepended" framing that LZ4 bindings decompress directly, so a client
+// asking for compressed bytes can use any of them.
+namespace lz4
+{
+
+inline constexpr std::size_t gSizeLength {4};
+inline constexpr std::size_t gMinMatch {4};
+// The last 5 bytes are always literals and the last match starts at least 12 bytes before the
+// end of the input.
+inline constexpr std::size_t gLastLiterals {5};
+inline constexpr std::size_t gMatchLimit {12};
+inline constexpr std::size_t gMaxOffset {65535};
+inline constexpr uint32_t gHashBits {12};
+
+inline uint32_t Read32(const char* aData)
+{
+    uint32_t lValue;
+    std::memcpy(&lValue, aData, sizeof(lValue));
+    return lValue;
+}
+
+inline uint32_t HashOf(uint32_t aSequence)
+{
+    return (aSequence * 2654435761u) >> (32 - gHashBits);
+}
+
+// Length of the common prefix of aLeft and aRight, compared a word at a time, up to aEnd.
+inline std::size_t CommonLength(const char* aLeft, const char* aRight, const char* aEnd)
+{
+    const char* const lStart = aLeft;
+    if constexpr(std::endian::native == std::endian::little)
+    {
+        while(aLeft + 8 <= aEnd)
+        {
+            uint64_t lLeft;
+            uint64_t lRight;
+            std::memcpy(&lLeft, aLeft, 8);
+            std::memcpy(&lRight, aRight, 8);
+            if(const uint64_t lDiff = lLeft ^ lRight; lDiff != 0)
+            {
+                return static_cast<std::size_t>(aLeft - lStart) + static_cast<std::size_t>(std::countr_zero(lDiff)) / 8;
+            }
+            aLeft += 8;
+            aRight += 8;
+        }
+    }
+    while(aLeft < aEnd && *aLeft == *aRight)
+    {
+        ++aLeft;
+        ++aRight;
+    }
+    return static_cast<std::size_t>(aLeft - lStart);
+}
+
+// Lengths of 15 and more spill into bytes of 255 plus a remainder.
+inline char* PutLength(char* aOut, std::size_t aLength)
+{
+    for(; aLength >= 255; aLength -= 255)
+    {
+        *aOut++ = static_cast<char>(255);
+    }
+    *aOut++ = static_cast<char>(aLength);
+    return aOut;
+}
+
+inline char* PutSequence(char* aOut, const char* aLiterals, std::size_t aLiteralLength, std::size_t aOffset, std::size_t aMatchLength)
+{
+    char* const lToken = aOut++;
+    *lToken = static_cast<char>(std::min<std::size_t>(aLiteralLength, 15) << 4);
+    if(aLiteralLength >= 15)
+    {
+        aOut = PutLength(aOut, aLiteralLength - 15);
+    }
+    std::memcpy(aOut, aLiterals, aLiteralLength);
+    aOut += aLiteralLength;
+    if(aMatchLength == 0)
+    {
+        return aOut;
+    }
+
+    *aOut++ = static_cast<char>(aOffset);
+    *aOut++ = static_cast<char>(aOffset >> 8);
+    const std::size_t lMatchLength = aMatchLength - gMinMatch;
+    *lToken = static_cast<char>(*lToken | std::min<std::size_t>(lMatchLength, 15));
+    if(lMatchLength >= 15)
+    {
+        aOut = PutLength(aOut, lMatchLength - 15);
+    }
+    return aOut;
+}
+
+// Copies a match of aLength bytes starting aOffset bytes back. Overlapping matches repeat the
+// bytes just written; with an offset of at least 16 every 16 byte block reads finished output.
+inline void CopyMatch(char* aOut, std::size_t aOffset, std::size_t aLength)
+{
+    const char* lFrom = aOut - aOffset;
+    if(aOffset >= 16)
+    {
+        for(; aLength >= 16; aLength -= 16, aOut += 16, lFrom += 16)
+        {
+            std::memcpy(aOut, lFrom, 16);
+        }
+    }
+    for(; aLength > 0; --aLength)
+    {
+        *aOut++ = *lFrom++;
+    }
+}
+
+} // namespace lz4
+
+// Replaces aOut with the stored LZ4 form of aInput.
+inline void CompressLz4(std::string_view aInput, std::string& aOut)
+{
+    using namespace lz4;
+    const std::size_t lLength = aInput.size();
+    aOut.resize(gSizeLength + lLength + lLength / 255 + 16);
+    char* lOut = aOut.data();
+    for(std::size_t i = 0; i < gSizeLength; ++i)
+    {
+        *lOut++ = static_cast<char>(lLength >> (8 * i));
+    }
+
+    const char* const lBase = aInput.data();
+    const char* lAnchor = lBase;
+    if(lLength > gMatchLimit)
+    {
+        const char* const lLastStart = lBase + lLength - gMatchLimit;
+        const char* const lMatchEnd = lBase + lLength - gLastLiterals;
+        uint32_t lTable[1u << gHashBits] {};
+        const char* lIn = lBase;
+        // Positions are skipped faster the longer no match was found, so incompressible data
+        // costs little.
+        std::size_t lMisses {1u << 6};
+        while(lIn < lLastStart)
+        {
+            uint32_t& lSlot = lTable[HashOf(Read32(lIn))];
+            const char* lRef = lBase + lSlot;
+            lSlot = static_cast<uint32_t>(lIn - lBase);
+            if(lRef >= lIn || static_cast<std::size_t>(lIn - lRef) > gMaxOffset || Read32(lRef) != Read32(lIn))
+            {
+                lIn += lMisses++ >> 6;
+                continue;
+            }
+
+            // Extend backwards over literals that match too.
+            while(lIn > lAnchor && lRef > lBase && lIn[-1] == lRef[-1])
+            {
+                --lIn;
+                --lRef;
+            }
+            const std::size_t lMatchLength = gMinMatch + CommonLength(lIn + gMinMatch, lRef + gMinMatch, lMatchEnd);
+            lOut = PutSequence(lOut, lAnchor, static_cast<std::size_t>(lIn - lAnchor), static_cast<std::size_t>(lIn - lRef), lMatchLength);
+            lIn += lMatchLength;
+            lAnchor = lIn;
+            lMisses = 1u << 6;
+        }
+    }
+    lOut = PutSequence(lOut, lAnchor, static_cast<std::size_t>(lBase + lLength - lAnchor), 0, 0);
+    aOut.resize(static_cast<std::size_t>(lOut - aOut.data()));
+}
+
+// Uncompressed length of a stored LZ4 value.
+inline std::size_t Lz4DecodedSize(std::string_view aStored)
+{
+    if(aStored.size() < lz4::gSizeLength)
+    {
+        return 0;
+    }
+    uint32_t lLength {0};
+    for(std::size_t i = 0; i < lz4::gSizeLength; ++i)
+    {
+        lLength |= static_cast<uint32_t>(static_cast<unsigned char>(aStored[i])) << (8 * i);
+    }
+    return lLength;
+}
+
+// Writes the Lz4DecodedSize(aStored) bytes of a stored LZ4 value to aOut. Every length and
+// offset is checked, so damaged input fails instead of reading or writing out of bounds.
+inline bool DecompressLz4(std::string_view aStored, char* aOut)
+{
+    using namespace lz4;
+    if(aStored.size() < gSizeLength)
+    {
+        return false;
+    }
+    const std::size_t lLength = Lz4DecodedSize(aStored);
+    const unsigned char* lIn = reinterpret_cast<const unsigned char*>(aStored.data()) + gSizeLength;
+    const unsigned char* const lInEnd = reinterpret_cast<const unsigned char*>(aStored.data()) + aStored.size();
+    char* lOut = aOut;
+    char* const lOutEnd = aOut + lLength;
+
+    auto lReadLength = [&](std::size_t& aValue) -> bool {
+        unsigned char lByte;
+        do
+        {
+            if(lIn == lInEnd)
+            {
+                return false;
+            }
+            lByte = *lIn++;
+            aValue += lByte;
+        } while(lByte == 255);
+        return true;
+    };
+
+    while(lIn < lInEnd)
+    {
+        const unsigned char lToken = *lIn++;
+        std::size_t lLiteralLength = lToken >> 4;
+        if(lLiteralLength == 15 && lReadLength(lLiteralLength) == false)
+        {
+            return false;
+        }
+        if(lLiteralLength > static_cast<std::size_t>(lInEnd - lIn) || lLiteralLength > static_cast<std::size_t>(lOutEnd - lOut))
+        {
+            return false;
+        }
+        std::memcpy(lOut, lIn, lLiteralLength);
+        lIn += lLiteralLength;
+        lOut += lLiteralLength;
+        if(lIn == lInEnd)
+        {
+            break;
+        }
+
+        if(lInEnd - lIn < 2)
+        {
+            return false;
+        }
+        const std::size_t lOffset = static_cast<std::size_t>(lIn[0]) | static_cast<std::size_t>(lIn[1]) << 8;
+        lIn += 2;
+        std::size_t lMatchLength = lToken & 15;
+        if(lMatchLength == 15 && lReadLength(lMatchLength) == false)
+        {
+            return false;
+        }
+        lMatchLength += gMinMatch;
+        if(lOffset == 0 || lOffset > static_cast<std::size_t>(lOut - aOut) || lMatchLength > static_cast<std::size_t>(lOutEnd - lOut))
+        {
+            return false;
+        }
+        CopyMatch(lOut, lOffset, lMatchLength);
+        lOut += lMatchLength;
+    }
+    return lOut == lOutEnd;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <string_view>
+#include <algorithm>
+#include <cstdint>
+
+// Approximate eviction policies of the storage engine. Every entry carries one 32 bit access
+// word which the read path updates with relaxed atomics under the shard's shared lock, so a
+// GET never takes a list lock or dirties anything but its own entry:
+//  - LRU  : the word is the coarse time of the last access; victims are the oldest of a few
+//           sampled entries (sampled LRU).
+//  - LFU  : the low 8 bits are a logarithmic access counter, the upper 24 bits the minute it was
+//           last decayed; the counter halves its growth rate as it rises and loses one per idle
+//           minute. Victims are the least used of a few sampled entries.
+//  - CLOCK: bit 0 is a reference bit, set on access and cleared by the clock hand, which
+//           evicts the first entry found unreferenced.
+// Time is counted in the engine's coarse ticks (see InMemoryDB::mExpiryTick).
+
+enum class EvictionPolicy : uint8_t
+{
+    LRU,
+    LFU,
+    CLOCK
+};
+
+inline constexpr std::string_view ToString(EvictionPolicy aPolicy)
+{
+    constexpr std::array<std::string_view, 3> lNames {"lru", "lfu", "clock"};
+    return lNames[static_cast<std::size_t>(aPolicy)];
+}
+
+inline bool ParseEvictionPolicy(std::string_view aName, EvictionPolicy& aPolicy)
+{
+    for(uint8_t i = 0; i <= static_cast<uint8_t>(EvictionPolicy::CLOCK); ++i)
+    {
+        if(aName == ToString(static_cast<EvictionPolicy>(i)))
+        {
+            aPolicy = static_cast<EvictionPolicy>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+class AccessTracker
+{
+    static constexpr uint32_t mLfuInitial {5};
+    static constexpr uint32_t mLfuLogFactor {10};
+    static constexpr uint32_t mTicksPerMinute {600};
+
+public:
+    static uint32_t Initial(EvictionPolicy aPolicy, uint32_t aNow)
+    {
+        switch(aPolicy)
+        {
+            case EvictionPolicy::LRU:
+                return aNow;
+            case EvictionPolicy::LFU:
+                return LfuWord(Minutes(aNow), mLfuInitial);
+            case EvictionPolicy::CLOCK:
+                return 1;
+        }
+        return 0;
+    }
+
+    static void Touch(std::atomic<uint32_t>& aWord, EvictionPolicy aPolicy, uint32_t aNow)
+    {
+        const uint32_t lWord = aWord.load(std::memory_order_relaxed);
+        uint32_t lNewWord {lWord};
+        switch(aPolicy)
+        {
+            case EvictionPolicy::LRU:
+                lNewWord = aNow;
+                break;
+            case EvictionPolicy::LFU:
+            {
+                const uint32_t lCounter = Increment(Decayed(lWord, aNow));
+                lNewWord = LfuWord(Minutes(aNow), lCounter);
+                break;
+            }
+            case EvictionPolicy::CLOCK:
+                lNewWord = 1;
+                break;
+        }
+
+        // Only write when something changed, so hot keys do not keep bouncing their cache line.
+        if(lNewWord != lWord)
+        {
+            aWord.store(lNewWord, std::memory_order_relaxed);
+        }
+    }
+
+    // Higher means a better eviction candidate. Not used by CLOCK.
+    static uint32_t Score(uint32_t aWord, EvictionPolicy aPolicy, uint32_t aNow)
+    {
+        if(aPolicy == EvictionPolicy::LFU)
+        {
+            return 255 - Decayed(aWord, aNow);
+        }
+        return aNow - aWord;
+    }
+
+    // CLOCK hand: returns true and clears the bit for a referenced entry, which is spared once.
+    static bool SecondChance(std::atomic<uint32_t>& aWord)
+    {
+        return aWord.exchange(0, std::memory_order_relaxed) != 0;
+    }
+
+private:
+    static uint32_t Minutes(uint32_t aNow)
+    {
+        return (aNow / mTicksPerMinute) & 0xFFFFFF;
+    }
+
+    static uint32_t LfuWord(uint32_t aMinutes, uint32_t aCounter)
+    {
+        return aMinutes << 8 | aCounter;
+    }
+
+    static uint32_t Decayed(uint32_t aWord, uint32_t aNow)
+    {
+        const uint32_t lCounter = aWord & 0xFF;
+        const uint32_t lIdle = (Minutes(aNow) - (aWord >> 8)) & 0xFFFFFF;
+        return lIdle >= lCounter ? 0 : lCounter - lIdle;
+    }
+
+    static uint32_t Increment(uint32_t aCounter)
+    {
+        if(aCounter == 255)
+        {
+            return aCounter;
+        }
+        const uint32_t lBase = aCounter > mLfuInitial ? aCounter - mLfuInitial : 0;
+        const uint64_t lThreshold = (1ull << 32) / (static_cast<uint64_t>(lBase) * mLfuLogFactor + 1);
+        return Random() < lThreshold ? aCounter + 1 : aCounter;
+    }
+
+    static uint32_t Random()
+    {
+        thread_local uint64_t lState {0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(&lState)};
+        lState ^= lState << 13;
+        lState ^= lState >> 7;
+        lState ^= lState << 17;
+        return static_cast<uint32_t>(lState);
+    }
+};
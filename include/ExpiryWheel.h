@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Hierarchical timer wheel used for active key expiry, one per shard and guarded by the shard
+// lock. Time is counted in ticks (InMemoryDB::mExpiryTick). Level 0 has one slot per tick,
+// every further level covers a full turn of the level below in each of its slots; deadlines
+// beyond the last level are parked in its farthest slot.
+//
+// Entries do not hold the key but its hash and the arm generation the store gave the key when
+// scheduling it, 16 bytes whatever the key length. The store keeps the generation of the one
+// entry it considers armed with the key; any other entry for the key, left behind by a delete,
+// an overwrite or an earlier deadline, no longer matches and is dropped when it fires or when
+// the store purges the wheel.
+//
+// The wheel only ever fires early, never late: a key that fires before its deadline (it was
+// parked, or its TTL was extended after scheduling) is simply scheduled again. This lets the
+// store skip scheduling when a TTL is extended, so refreshing a session key does not add
+// entries.
+class ExpiryWheel
+{
+    static constexpr uint32_t mSlotBits {6};
+    static constexpr uint32_t mNrOfSlots {1u << mSlotBits};
+    static constexpr uint32_t mSlotMask {mNrOfSlots - 1};
+    static constexpr uint32_t mNrOfLevels {4};
+
+public:
+    struct WheelEntry
+    {
+        std::size_t mHash;
+        uint32_t mDeadline;
+        uint32_t mArm;
+    };
+
+    // Longest distance, in ticks, the wheel can represent without parking.
+    static constexpr uint64_t mSpan {1ull << (mSlotBits * mNrOfLevels)};
+
+    explicit ExpiryWheel(uint32_t aNow = 0) : mCurrent{aNow} {}
+
+    void Schedule(std::size_t aHash, uint32_t aArm, uint32_t aDeadline)
+    {
+        Place({aHash, aDeadline, aArm});
+        ++mSize;
+    }
+
+    // Advances the wheel to aNow, handing every entry whose deadline is reached to
+    // aCheck(std::size_t aHash, uint32_t aArm) -> uint32_t, which expires the key if due and
+    // returns its current deadline, or 0 when the entry is stale or the key no longer expires.
+    // Entries whose deadline is still ahead are scheduled again. At most aBudget entries are
+    // looked at, the rest is left for the next call. Returns the number of entries looked at.
+    template<typename Check>
+    std::size_t Advance(uint32_t aNow, std::size_t aBudget, Check&& aCheck)
+    {
+        std::size_t lVisited {0};
+        while(mCurrent < aNow || mSlots[0][mCurrent & mSlotMask].empty() == false)
+        {
+            std::vector<WheelEntry>& lSlot = mSlots[0][mCurrent & mSlotMask];
+            while(lSlot.empty() == false)
+            {
+                if(lVisited == aBudget)
+                {
+                    return lVisited;
+                }
+
+                WheelEntry lEntry = lSlot.back();
+                lSlot.pop_back();
+                --mSize;
+                ++lVisited;
+
+                lEntry.mDeadline = aCheck(lEntry.mHash, lEntry.mArm);
+                if(lEntry.mDeadline > mCurrent)
+                {
+                    Place(lEntry);
+                    ++mSize;
+                }
+            }
+
+            if(mCurrent == aNow)
+            {
+                break;
+            }
+            ++mCurrent;
+            Cascade();
+        }
+        return lVisited;
+    }
+
+    // Drops every entry for which aLive(std::size_t aHash, uint32_t aArm) is false. Returns the
+    // number of entries dropped.
+    template<typename Live>
+    std::size_t Purge(Live&& aLive)
+    {
+        std::size_t lDropped {0};
+        for(auto& lLevel : mSlots)
+        {
+            for(std::vector<WheelEntry>& lSlot : lLevel)
+            {
+                lDropped += std::erase_if(lSlot, [&](const WheelEntry& aEntry) { return aLive(aEntry.mHash, aEntry.mArm) == false; });
+            }
+        }
+        mSize -= lDropped;
+        return lDropped;
+    }
+
+    std::size_t Size() const
+    {
+        return mSize;
+    }
+
+private:
+    void Place(const WheelEntry& aEntry)
+    {
+        // A deadline that already passed goes in the current slot, to be handled right away.
+        const uint64_t lDelta = aEntry.mDeadline > mCurrent ? aEntry.mDeadline - mCurrent : 0;
+        const uint64_t lDeadline = lDelta < mSpan ? mCurrent + lDelta : mCurrent + mSpan - 1;
+
+        uint32_t lLevel {0};
+        while(lLevel + 1 < mNrOfLevels && lDeadline - mCurrent >= (1ull << (mSlotBits * (lLevel + 1))))
+        {
+            ++lLevel;
+        }
+        const uint32_t lSlot = static_cast<uint32_t>(lDeadline >> (mSlotBits * lLevel)) & mSlotMask;
+        mSlots[lLevel][lSlot].push_back(aEntry);
+    }
+
+    // When a level completes a turn, the slot of the next level that now comes within reach is
+    // spread over the lower levels.
+    void Cascade()
+    {
+        for(uint32_t lLevel = 1; lLevel < mNrOfLevels; ++lLevel)
+        {
+            if((mCurrent & ((1u << (mSlotBits * lLevel)) - 1)) != 0)
+            {
+                break;
+            }
+
+            std::vector<WheelEntry> lEntries;
+            lEntries.swap(mSlots[lLevel][(mCurrent >> (mSlotBits * lLevel)) & mSlotMask]);
+            for(const WheelEntry& lEntry : lEntries)
+            {
+                Place(lEntry);
+            }
+        }
+    }
+
+    std::array<std::array<std::vector<WheelEntry>, mNrOfSlots>, mNrOfLevels> mSlots {};
+    uint32_t mCurrent;
+    std::size_t mSize {0};
+};
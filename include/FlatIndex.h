@@ -0,0 +1,566 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Open addressing hash index of one shard, laid out like a Swiss table.
+//
+// Entries sit in one flat array of slots next to an array of control bytes, one per slot: the
+// slot is empty, deleted, or holds an entry whose hash has the 7 bit fingerprint stored in the
+// byte. A lookup loads the control bytes of 16 slots at once, compares them all against the
+// fingerprint with a single SIMD instruction, and only looks at the keys that match, so a probe
+// costs one or two cache lines instead of a pointer chase per node. The caller passes the hash
+// in, so a request hashes its key once for both the shard choice and the lookup.
+//
+// Growth is incremental: when the table fills up, a new one is allocated and the old one is
+// drained a few groups at a time by later inserts (and by Migrate), looking up both tables in
+// the meantime, so no single write pays for moving the whole index.
+//
+// Inserting invalidates iterators and references; erasing does not.
+//
+// Scan walks the entries with a stateless cursor that survives growth (see there).
+template<typename Key, typename Mapped, typename Hash>
+class FlatIndex
+{
+public:
+    using value_type = std::pair<Key, Mapped>;
+
+    static constexpr std::size_t mGroupWidth {16};
+    // Old table slots moved per insert while a resize is in progress. A new table is at least
+    // as large as the old one and starts at most 7/16 full, so the old one is always drained
+    // long before the new one fills up.
+    static constexpr std::size_t mMigrationStep {64};
+
+    template<bool Const>
+    class Iterator
+    {
+    public:
+        using Index = std::conditional_t<Const, const FlatIndex, FlatIndex>;
+        using Reference = std::conditional_t<Const, const value_type&, value_type&>;
+        using Pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+        Iterator(Index* aIndex, std::size_t aPosition) : mIndex{aIndex}, mPosition{aPosition} {}
+
+        operator Iterator<true>() const requires (Const == false)
+        {
+            return {mIndex, mPosition};
+        }
+
+        Reference operator*() const
+        {
+            return *mIndex->SlotAt(mPosition);
+        }
+
+        Pointer operator->() const
+        {
+            return mIndex->SlotAt(mPosition);
+        }
+
+        Iterator& operator++()
+        {
+            mPosition = mIndex->NextFull(mPosition + 1);
+            return *this;
+        }
+
+        bool operator==(const Iterator& aOther) const = default;
+
+    private:
+        friend class FlatIndex;
+
+        Index* mIndex;
+        std::size_t mPosition;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatIndex() = default;
+    FlatIndex(const FlatIndex&) = delete;
+    FlatIndex& operator=(const FlatIndex&) = delete;
+
+    ~FlatIndex()
+    {
+        FreeTable(mTable);
+        FreeTable(mOld);
+    }
+
+    template<typename Lookup>
+    iterator find(const Lookup& aKey, std::size_t aHash)
+    {
+        return {this, Find(aKey, aHash)};
+    }
+
+    template<typename Lookup>
+    const_iterator find(const Lookup& aKey, std::size_t aHash) const
+    {
+        return {this, Find(aKey, aHash)};
+    }
+
+    // First slot on the probe path of aHash for which aMatch(const value_type&) holds. Slots of
+    // other hashes sharing the fingerprint are offered too, so aMatch has to tell them apart.
+    template<typename Match>
+    iterator find_if(std::size_t aHash, Match&& aMatch)
+    {
+        return {this, FindMatch(aHash, aMatch)};
+    }
+
+    // Inserts a key that is not in the index yet.
+    template<typename Lookup>
+    iterator emplace(const Lookup& aKey, std::size_t aHash, Mapped&& aMapped)
+    {
+        if(mOld.mCapacity != 0)
+        {
+            Migrate(mMigrationStep);
+        }
+        if(mTable.mGrowthLeft == 0)
+        {
+            Grow();
+        }
+        return {this, InsertInto(mTable, aHash, aKey, std::move(aMapped))};
+    }
+
+    void erase(iterator aIt)
+    {
+        auto [lTable, lIndex] = Locate(aIt.mPosition);
+        lTable->mSlots[lIndex].~value_type();
+        SetControl(*lTable, lIndex, mDeleted);
+        --lTable->mSize;
+    }
+
+    // Moves up to aBudget slots of a table being drained into the current one.
+    void Migrate(std::size_t aBudget)
+    {
+        const std::size_t lEnd = std::min(mOld.mCapacity, mMigrated + aBudget);
+        for(; mMigrated < lEnd; ++mMigrated)
+        {
+            if(IsFull(mOld.mControl[mMigrated]))
+            {
+                value_type& lSlot = mOld.mSlots[mMigrated];
+                InsertInto(mTable, Hash{}(lSlot.first), std::move(lSlot.first), std::move(lSlot.second));
+                lSlot.~value_type();
+                SetControl(mOld, mMigrated, mDeleted);
+                --mOld.mSize;
+            }
+        }
+        if(mMigrated == mOld.mCapacity)
+        {
+            FreeTable(mOld);
+        }
+    }
+
+    std::size_t size() const
+    {
+        return mTable.mSize + mOld.mSize;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    // Slots of the current table; size() / bucket_count() is the load factor, kept under 7/8.
+    std::size_t bucket_count() const
+    {
+        return mTable.mCapacity;
+    }
+
+    iterator begin()
+    {
+        return {this, NextFull(0)};
+    }
+
+    iterator end()
+    {
+        return {this, SlotCount()};
+    }
+
+    const_iterator begin() const
+    {
+        return {this, NextFull(0)};
+    }
+
+    const_iterator end() const
+    {
+        return {this, SlotCount()};
+    }
+
+    // Slots are addressed by position, the current table's first and then those of the one
+    // being drained; walks that resume from a saved position (eviction, compaction) use these.
+    // Positions move when the index grows.
+    std::size_t SlotCount() const
+    {
+        return mTable.mCapacity + mOld.mCapacity;
+    }
+
+    // The entry at aPosition, end() when that slot holds none.
+    iterator At(std::size_t aPosition)
+    {
+        return IsFullAt(aPosition) ? iterator{this, aPosition} : end();
+    }
+
+    // One step of a cursor walk over the entries, for SCAN. The cursor names a bucket, the
+    // mGroupWidth home positions whose entries aVisit is called for, in both tables while one is
+    // being drained, and the next cursor is returned, 0 once every bucket was visited. Cursors
+    // count with the bits reversed, as Redis' dictScan does: a larger table splits each bucket
+    // of a smaller one by the bits above its mask, so visiting the buckets in that order still
+    // sees every entry that is present for the whole walk when the index grows in between.
+    // Entries may be visited more than once.
+    template<typename Visit>
+    std::size_t Scan(std::size_t aCursor, Visit&& aVisit) const
+    {
+        if(mTable.mCapacity == 0)
+        {
+            return 0;
+        }
+        const std::size_t lLargeMask = BucketMask(mTable);
+        if(mOld.mCapacity == 0)
+        {
+            ScanBucket(mTable, aCursor & lLargeMask, aVisit);
+            return NextCursor(aCursor, lLargeMask);
+        }
+
+        // The table being drained is never the larger one: visit its bucket, then every bucket
+        // of the current table it expands to.
+        const std::size_t lSmallMask = BucketMask(mOld);
+        ScanBucket(mOld, aCursor & lSmallMask, aVisit);
+        do
+        {
+            ScanBucket(mTable, aCursor & lLargeMask, aVisit);
+            aCursor = NextCursor(aCursor, lLargeMask);
+        } while((aCursor & (lSmallMask ^ lLargeMask)) != 0);
+        return aCursor;
+    }
+
+private:
+    static constexpr int8_t mEmpty {-128};
+    static constexpr int8_t mDeleted {-2};
+
+    struct Table
+    {
+        // mCapacity + mGroupWidth bytes; the last group mirrors the first so that a group can
+        // be loaded from any position without wrapping.
+        int8_t* mControl {nullptr};
+        value_type* mSlots {nullptr};
+        std::size_t mCapacity {0};
+        std::size_t mSize {0};
+        // Empty slots that may still be filled before the table reaches its 7/8 load limit.
+        std::size_t mGrowthLeft {0};
+    };
+
+    class Group
+    {
+    public:
+#if defined(__SSE2__)
+        explicit Group(const int8_t* aControl) : mControl{_mm_loadu_si128(reinterpret_cast<const __m128i*>(aControl))} {}
+
+        uint32_t Match(int8_t aByte) const
+        {
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(mControl, _mm_set1_epi8(aByte))));
+        }
+
+        // Empty and deleted are the only control bytes with the sign bit set.
+        uint32_t MatchEmptyOrDeleted() const
+        {
+            return static_cast<uint32_t>(_mm_movemask_epi8(mControl));
+        }
+
+    private:
+        __m128i mControl;
+#else
+        explicit Group(const int8_t* aControl)
+        {
+            std::memcpy(mControl, aControl, mGroupWidth);
+        }
+
+        uint32_t Match(int8_t aByte) const
+        {
+            uint32_t lMask {0};
+            for(std::size_t i = 0; i < mGroupWidth; ++i)
+            {
+                lMask |= static_cast<uint32_t>(mControl[i] == aByte) << i;
+            }
+            return lMask;
+        }
+
+        uint32_t MatchEmptyOrDeleted() const
+        {
+            uint32_t lMask {0};
+            for(std::size_t i = 0; i < mGroupWidth; ++i)
+            {
+                lMask |= static_cast<uint32_t>(mControl[i] < 0) << i;
+            }
+            return lMask;
+        }
+
+    private:
+        int8_t mControl[mGroupWidth];
+#endif
+
+    public:
+        uint32_t MatchEmpty() const
+        {
+            return Match(mEmpty);
+        }
+    };
+
+    // The low 7 bits of the hash are the fingerprint, the rest picks the first group.
+    static int8_t Fingerprint(std::size_t aHash)
+    {
+        return static_cast<int8_t>(aHash & 0x7F);
+    }
+
+    static std::size_t Home(std::size_t aHash)
+    {
+        return aHash >> 7;
+    }
+
+    static bool IsFull(int8_t aControl)
+    {
+        return aControl >= 0;
+    }
+
+    // Smallest table holding aSize entries at no more than 7/16 load, i.e. half the limit.
+    static std::size_t CapacityFor(std::size_t aSize)
+    {
+        return std::max(mGroupWidth, std::bit_ceil((aSize * 16 + 6) / 7));
+    }
+
+    static Table MakeTable(std::size_t aCapacity)
+    {
+        static_assert(alignof(value_type) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+        const std::size_t lControlLength = aCapacity + mGroupWidth;
+        char* lMemory = static_cast<char*>(::operator new(lControlLength + aCapacity * sizeof(value_type)));
+        Table lTable;
+        lTable.mControl = reinterpret_cast<int8_t*>(lMemory);
+        lTable.mSlots = reinterpret_cast<value_type*>(lMemory + lControlLength);
+        lTable.mCapacity = aCapacity;
+        lTable.mGrowthLeft = aCapacity - aCapacity / 8;
+        std::memset(lTable.mControl, static_cast<unsigned char>(mEmpty), lControlLength);
+        return lTable;
+    }
+
+    static void FreeTable(Table& aTable)
+    {
+        for(std::size_t i = 0; i < aTable.mCapacity && aTable.mSize > 0; ++i)
+        {
+            if(IsFull(aTable.mControl[i]))
+            {
+                aTable.mSlots[i].~value_type();
+                --aTable.mSize;
+            }
+        }
+        ::operator delete(aTable.mControl);
+        aTable = Table{};
+    }
+
+    static void SetControl(Table& aTable, std::size_t aIndex, int8_t aControl)
+    {
+        aTable.mControl[aIndex] = aControl;
+        if(aIndex < mGroupWidth)
+        {
+            aTable.mControl[aTable.mCapacity + aIndex] = aControl;
+        }
+    }
+
+    // Probes group by group, with triangular steps that visit every group of a power of two
+    // table. Terminates since at least an eighth of the slots are always empty.
+    template<typename Match>
+    static std::size_t FindIn(const Table& aTable, std::size_t aHash, Match& aMatch)
+    {
+        if(aTable.mCapacity == 0)
+        {
+            return mNotFound;
+        }
+        const std::size_t lMask = aTable.mCapacity - 1;
+        std::size_t lPosition = Home(aHash) & lMask;
+        for(std::size_t lStep = mGroupWidth;; lStep += mGroupWidth)
+        {
+            const Group lGroup{aTable.mControl + lPosition};
+            for(uint32_t lMatch = lGroup.Match(Fingerprint(aHash)); lMatch != 0; lMatch &= lMatch - 1)
+            {
+                const std::size_t lIndex = (lPosition + static_cast<std::size_t>(std::countr_zero(lMatch))) & lMask;
+                if(aMatch(aTable.mSlots[lIndex]))
+                {
+                    return lIndex;
+                }
+            }
+            if(lGroup.MatchEmpty() != 0)
+            {
+                return mNotFound;
+            }
+            lPosition = (lPosition + lStep) & lMask;
+        }
+    }
+
+    template<typename... Args>
+    static std::size_t InsertInto(Table& aTable, std::size_t aHash, Args&&... aArgs)
+    {
+        const std::size_t lMask = aTable.mCapacity - 1;
+        std::size_t lPosition = Home(aHash) & lMask;
+        for(std::size_t lStep = mGroupWidth;; lStep += mGroupWidth)
+        {
+            const uint32_t lFree = Group{aTable.mControl + lPosition}.MatchEmptyOrDeleted();
+            if(lFree != 0)
+            {
+                const std::size_t lIndex = (lPosition + static_cast<std::size_t>(std::countr_zero(lFree))) & lMask;
+                if(aTable.mControl[lIndex] == mEmpty)
+                {
+                    --aTable.mGrowthLeft;
+                }
+                new(&aTable.mSlots[lIndex]) value_type(std::forward<Args>(aArgs)...);
+                SetControl(aTable, lIndex, Fingerprint(aHash));
+                ++aTable.mSize;
+                return lIndex;
+            }
+            lPosition = (lPosition + lStep) & lMask;
+        }
+    }
+
+    // Starts draining the full table into a new one, larger unless most of the load was
+    // deleted slots.
+    void Grow()
+    {
+        if(mOld.mCapacity != 0)
+        {
+            Migrate(mOld.mCapacity);
+        }
+        const std::size_t lCapacity = std::max(mTable.mCapacity, CapacityFor(mTable.mSize + 1));
+        mOld = mTable;
+        mTable = MakeTable(lCapacity);
+        mMigrated = 0;
+        if(mOld.mSize == 0)
+        {
+            FreeTable(mOld);
+        }
+    }
+
+    static std::size_t BucketMask(const Table& aTable)
+    {
+        return aTable.mCapacity / mGroupWidth - 1;
+    }
+
+    // Increments the bits of aCursor under aMask from the top down.
+    static std::size_t NextCursor(std::size_t aCursor, std::size_t aMask)
+    {
+        aCursor |= ~aMask;
+        aCursor = ReverseBits(aCursor);
+        ++aCursor;
+        return ReverseBits(aCursor);
+    }
+
+    static uint64_t ReverseBits(uint64_t aValue)
+    {
+        aValue = ((aValue >> 1) & 0x5555555555555555ull) | ((aValue & 0x5555555555555555ull) << 1);
+        aValue = ((aValue >> 2) & 0x3333333333333333ull) | ((aValue & 0x3333333333333333ull) << 2);
+        aValue = ((aValue >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((aValue & 0x0F0F0F0F0F0F0F0Full) << 4);
+        return __builtin_bswap64(aValue);
+    }
+
+    // Visits the entries whose home lies in the bucket by following the probe sequences of its
+    // homes the way FindIn does, step by step for all of them at once: a step covers the groups
+    // of all homes still probing, and a home stops at its first group with an empty slot. An
+    // entry is reported at the step whose group of its own home holds it, so once per walk.
+    template<typename Visit>
+    static void ScanBucket(const Table& aTable, std::size_t aBucket, Visit& aVisit)
+    {
+        const std::size_t lMask = aTable.mCapacity - 1;
+        const std::size_t lFirst = aBucket * mGroupWidth;
+        const std::size_t lSpan = std::min(aTable.mCapacity, 2 * mGroupWidth - 1);
+        uint32_t lProbing {(1u << mGroupWidth) - 1};
+        for(std::size_t lOffset = 0, lStep = mGroupWidth; lProbing != 0; lOffset += lStep, lStep += mGroupWidth)
+        {
+            for(std::size_t i = 0; i < lSpan; ++i)
+            {
+                const std::size_t lIndex = (lFirst + lOffset + i) & lMask;
+                if(IsFull(aTable.mControl[lIndex]) == false)
+                {
+                    continue;
+                }
+                const value_type& lSlot = aTable.mSlots[lIndex];
+                const std::size_t lHome = Home(Hash{}(lSlot.first)) & lMask;
+                const std::size_t lDelta = (lHome - lFirst) & lMask;
+                if(lDelta < mGroupWidth && (lProbing >> lDelta & 1) != 0 && ((lIndex - lHome - lOffset) & lMask) < mGroupWidth)
+                {
+                    aVisit(lSlot);
+                }
+            }
+            for(uint32_t lHomes = lProbing; lHomes != 0; lHomes &= lHomes - 1)
+            {
+                const std::size_t lDelta = static_cast<std::size_t>(std::countr_zero(lHomes));
+                if(Group{aTable.mControl + ((lFirst + lDelta + lOffset) & lMask)}.MatchEmpty() != 0)
+                {
+                    lProbing &= ~(1u << lDelta);
+                }
+            }
+        }
+    }
+
+    template<typename Lookup>
+    std::size_t Find(const Lookup& aKey, std::size_t aHash) const
+    {
+        auto lMatch = [&](const value_type& aSlot) { return aSlot.first == aKey; };
+        return FindMatch(aHash, lMatch);
+    }
+
+    template<typename Match>
+    std::size_t FindMatch(std::size_t aHash, Match& aMatch) const
+    {
+        std::size_t lIndex = FindIn(mTable, aHash, aMatch);
+        if(lIndex != mNotFound)
+        {
+            return lIndex;
+        }
+        lIndex = FindIn(mOld, aHash, aMatch);
+        return lIndex != mNotFound ? mTable.mCapacity + lIndex : SlotCount();
+    }
+
+    std::pair<Table*, std::size_t> Locate(std::size_t aPosition)
+    {
+        if(aPosition < mTable.mCapacity)
+        {
+            return {&mTable, aPosition};
+        }
+        return {&mOld, aPosition - mTable.mCapacity};
+    }
+
+    value_type* SlotAt(std::size_t aPosition) const
+    {
+        return aPosition < mTable.mCapacity ? mTable.mSlots + aPosition : mOld.mSlots + (aPosition - mTable.mCapacity);
+    }
+
+    bool IsFullAt(std::size_t aPosition) const
+    {
+        if(aPosition < mTable.mCapacity)
+        {
+            return IsFull(mTable.mControl[aPosition]);
+        }
+        return aPosition < SlotCount() && IsFull(mOld.mControl[aPosition - mTable.mCapacity]);
+    }
+
+    std::size_t NextFull(std::size_t aPosition) const
+    {
+        const std::size_t lEnd = SlotCount();
+        while(aPosition < lEnd && IsFullAt(aPosition) == false)
+        {
+            ++aPosition;
+        }
+        return aPosition;
+    }
+
+    static constexpr std::size_t mNotFound {static_cast<std::size_t>(-1)};
+
+    Table mTable;
+    // Table being drained into mTable, empty (zero capacity) when no resize is in progress.
+    Table mOld;
+    // Next slot of mOld to move.
+    std::size_t mMigrated {0};
+};
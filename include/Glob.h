@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <string_view>
+#include <cstddef>
+
+// Glob style key patterns, as SCAN takes them: * matches any run of bytes, ? any single byte,
+// [abc] and [a-z] a byte of the set, [^...] one outside it, and \ makes the next byte literal.
+namespace glob
+{
+
+// Whether the token at the start of aPattern, which matches exactly one byte, matches aByte.
+// Returns the length of the token; a set missing its ] runs to the end of the pattern.
+inline std::size_t MatchToken(std::string_view aPattern, unsigned char aByte, bool& aMatch)
+{
+    if(aPattern[0] == '?')
+    {
+        aMatch = true;
+        return 1;
+    }
+    if(aPattern[0] == '\\' && aPattern.size() > 1)
+    {
+        aMatch = static_cast<unsigned char>(aPattern[1]) == aByte;
+        return 2;
+    }
+    if(aPattern[0] != '[')
+    {
+        aMatch = static_cast<unsigned char>(aPattern[0]) == aByte;
+        return 1;
+    }
+
+    std::size_t i {1};
+    const bool lNegated = i < aPattern.size() && aPattern[i] == '^';
+    if(lNegated)
+    {
+        ++i;
+    }
+    bool lFound {false};
+    while(i < aPattern.size() && aPattern[i] != ']')
+    {
+        if(aPattern[i] == '\\' && i + 1 < aPattern.size())
+        {
+            lFound = lFound || static_cast<unsigned char>(aPattern[i + 1]) == aByte;
+            i += 2;
+        }
+        else if(i + 2 < aPattern.size() && aPattern[i + 1] == '-' && aPattern[i + 2] != ']')
+        {
+            unsigned char lLow = static_cast<unsigned char>(aPattern[i]);
+            unsigned char lHigh = static_cast<unsigned char>(aPattern[i + 2]);
+            if(lLow > lHigh)
+            {
+                std::swap(lLow, lHigh);
+            }
+            lFound = lFound || (aByte >= lLow && aByte <= lHigh);
+            i += 3;
+        }
+        else
+        {
+            lFound = lFound || static_cast<unsigned char>(aPattern[i]) == aByte;
+            ++i;
+        }
+    }
+    aMatch = lFound != lNegated;
+    return std::min(i + 1, aPattern.size());
+}
+
+} // namespace glob
+
+// Every token but * matches one byte, so a mismatch only has to go back to the last * and let
+// it take one more byte: linear in the text for patterns with a single *, never exponential.
+inline bool GlobMatch(std::string_view aPattern, std::string_view aText)
+{
+    constexpr std::size_t lNoStar {std::string_view::npos};
+    std::size_t lPattern {0};
+    std::size_t lText {0};
+    std::size_t lStarPattern {lNoStar};
+    std::size_t lStarText {0};
+    while(lText < aText.size())
+    {
+        if(lPattern < aPattern.size() && aPattern[lPattern] == '*')
+        {
+            lStarPattern = ++lPattern;
+            lStarText = lText;
+            continue;
+        }
+        if(lPattern < aPattern.size())
+        {
+            bool lMatch {false};
+            const std::size_t lLength = glob::MatchToken(aPattern.substr(lPattern), static_cast<unsigned char>(aText[lText]), lMatch);
+            if(lMatch)
+            {
+                lPattern += lLength;
+                ++lText;
+                continue;
+            }
+        }
+        if(lStarPattern == lNoStar)
+        {
+            return false;
+        }
+        lPattern = lStarPattern;
+        lText = ++lStarText;
+    }
+    while(lPattern < aPattern.size() && aPattern[lPattern] == '*')
+    {
+        ++lPattern;
+    }
+    return lPattern == aPattern.size();
+}
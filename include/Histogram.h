@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+// Log-linear histogram in the style of HdrHistogram: every power of two range is split into
+// mSubBuckets equal buckets, so a recorded value is known to within 1/mSubBuckets of itself
+// (under 1%) from 1 up to mMaxValue, at a fixed 35 KB and with Record a couple of instructions.
+// Meant for latencies in nanoseconds. Not thread safe: keep one per thread and Merge them.
+class Histogram
+{
+public:
+    static constexpr uint32_t mSubBucketBits {7};
+    static constexpr uint64_t mSubBuckets {uint64_t{1} << mSubBucketBits};
+    // Larger values, over 18 minutes in nanoseconds, are counted as mMaxValue.
+    static constexpr uint64_t mMaxValue {(uint64_t{1} << 40) - 1};
+
+    void Record(uint64_t aValue)
+    {
+        aValue = std::min(aValue, mMaxValue);
+        ++mCounts[IndexOf(aValue)];
+        ++mCount;
+        mSum += aValue;
+        mMax = std::max(mMax, aValue);
+    }
+
+    void Merge(const Histogram& aOther)
+    {
+        for(std::size_t i = 0; i < mCounts.size(); ++i)
+        {
+            mCounts[i] += aOther.mCounts[i];
+        }
+        mCount += aOther.mCount;
+        mSum += aOther.mSum;
+        mMax = std::max(mMax, aOther.mMax);
+    }
+
+    void Clear()
+    {
+        *this = Histogram{};
+    }
+
+    uint64_t Count() const
+    {
+        return mCount;
+    }
+
+    uint64_t Max() const
+    {
+        return mMax;
+    }
+
+    double Mean() const
+    {
+        return mCount == 0 ? 0.0 : static_cast<double>(mSum) / static_cast<double>(mCount);
+    }
+
+    // Smallest recorded value bound such that a fraction aQuantile (0..1) of the values is not
+    // above it; the upper end of its bucket, never above Max().
+    uint64_t Percentile(double aQuantile) const
+    {
+        if(mCount == 0)
+        {
+            return 0;
+        }
+        const uint64_t lRank = std::max<uint64_t>(1, static_cast<uint64_t>(aQuantile * static_cast<double>(mCount) + 0.5));
+        uint64_t lSeen {0};
+        for(std::size_t i = 0; i < mCounts.size(); ++i)
+        {
+            lSeen += mCounts[i];
+            if(lSeen >= lRank)
+            {
+                return std::min(UpperBoundOf(i), mMax);
+            }
+        }
+        return mMax;
+    }
+
+    // Calls aVisitor(uint64_t aUpperBound, uint64_t aCount) for every non-empty bucket, in order.
+    template<typename Visitor>
+    void ForEachBucket(Visitor&& aVisitor) const
+    {
+        for(std::size_t i = 0; i < mCounts.size(); ++i)
+        {
+            if(mCounts[i] != 0)
+            {
+                aVisitor(UpperBoundOf(i), mCounts[i]);
+            }
+        }
+    }
+
+private:
+    // Values below 2 * mSubBuckets have a bucket each; above, the bucket of a value is its top
+    // mSubBucketBits + 1 bits, offset by how far they were shifted.
+    static std::size_t IndexOf(uint64_t aValue)
+    {
+        if(aValue < 2 * mSubBuckets)
+        {
+            return static_cast<std::size_t>(aValue);
+        }
+        const uint32_t lShift = static_cast<uint32_t>(std::bit_width(aValue)) - (mSubBucketBits + 1);
+        return static_cast<std::size_t>(lShift * mSubBuckets + (aValue >> lShift));
+    }
+
+    static uint64_t UpperBoundOf(std::size_t aIndex)
+    {
+        if(aIndex < 2 * mSubBuckets)
+        {
+            return aIndex;
+        }
+        const uint64_t lShift = aIndex / mSubBuckets - 1;
+        const uint64_t lTop = aIndex - lShift * mSubBuckets;
+        return ((lTop + 1) << lShift) - 1;
+    }
+
+    static constexpr std::size_t mNrOfBuckets {(40 - (mSubBucketBits + 1)) * mSubBuckets + 2 * mSubBuckets};
+
+    std::array<uint64_t, mNrOfBuckets> mCounts {};
+    uint64_t mCount {0};
+    uint64_t mSum {0};
+    uint64_t mMax {0};
+};
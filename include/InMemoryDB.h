@@ -0,0 +1,1422 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <shared_mutex>
+#include <mutex>
+#include <thread>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <algorithm>
+#include <vector>
+#include <set>
+#include <span>
+#include <optional>
+#include <chrono>
+#include <atomic>
+#include <charconv>
+#include <stdexcept>
+#include "Logger.h"
+#include "ExpiryWheel.h"
+#include "Eviction.h"
+#include "AppendLog.h"
+#include "Value.h"
+#include "CompactKey.h"
+#include "FlatIndex.h"
+#include "Glob.h"
+
+// Key-value storage engine shared by every io thread of the server.
+// Keys are spread by hash over a power-of-two number of shards, each one guarded by its
+// own reader/writer lock, so requests touching different shards never contend and
+// concurrent readers of the same shard only share the lock.
+// Values are immutable and reference counted: a lookup hands out a ValueHandle instead of a
+// copy, and a SET replaces the handle, so readers still holding the old value are unaffected.
+//
+// Entries are laid out for density: each shard indexes them in a FlatIndex (open addressing,
+// SIMD probed, grown incrementally), keys are CompactKeys, inline up to 22 bytes, and values
+// are single chunks of the shard's SlabArena with their reference count in front; with
+// ConfigureCompression large values are kept LZ4 compressed and handed out that way. CompactTick,
+// driven by the server, moves live values off sparse slab pages so that memory freed by deletes
+// goes back to the system instead of staying scattered over half empty pages.
+//
+// Keys may carry a TTL. Every entry stores its deadline as a 4 byte tick count; reads treat
+// an entry past its deadline as missing (lazy expiry) and ExpireTick, driven periodically by
+// the server, reclaims them through a per shard timer wheel (active expiry). Wheel entries hold
+// the key's hash and an arm generation, not the key, and are charged to the memory budget.
+//
+// Memory can be bounded with ConfigureEviction. Every entry is charged its key, its value and
+// a fixed overhead; a write that takes the store over the budget evicts entries chosen by an
+// approximate policy (see Eviction.h), first from its own shard and, only when that one has
+// nothing left, from the others. Shards keep exact counts and publish them to one shared
+// counter in steps, so writes do not all contend on it.
+//
+// An ordered index of the keys can be kept next to the hash index (ConfigureOrderedIndex),
+// one sorted set per shard maintained under the shard lock. RangeScanRequest merges the shards'
+// sets, holding one shard lock at a time, to serve prefix and range scans in key order.
+//
+// With an AppendLog attached every change is queued to it under the shard lock, so the log
+// holds the writes of a key in the order they were applied.
+//
+// Read-modify-write ops (INCRBY, APPEND, GETSET, SETNX, CAS) run whole under the shard's
+// exclusive lock. Every write gives the entry a new version, drawn from a per shard counter
+// that starts from the wall clock, so a version is never reused, not even across restarts,
+// and CAS can tell any change apart. INCRBY keeps integers natively (Codec::INT64) and, when
+// no reader holds the value, updates them in place.
+class InMemoryDB
+{
+public:
+    using ValueHandle = ValueRef;
+
+    // Resolution of expiry deadlines.
+    static constexpr std::chrono::milliseconds mExpiryTick {100};
+    // Longest accepted TTL, well inside what a 32 bit tick count covers.
+    static constexpr uint64_t mMaxTtlMs {10ull * 365 * 24 * 3600 * 1000};
+    // Upper bound of wheel entries looked at per shard and ExpireTick, bounds the lock hold time.
+    static constexpr std::size_t mExpiryBudget {1000};
+    // Approximate bookkeeping cost of an entry beyond its key and value bytes: index slot (key,
+    // value handle, the 8 byte version, deadline, arm generation and access word) and control
+    // byte at the index's average load, value header and the rounding of the value to its slab
+    // class. Timer wheel entries are charged on their own, mWheelEntryCharge each.
+    static constexpr std::size_t mEntryOverhead {104};
+    static constexpr std::size_t mWheelEntryCharge {sizeof(ExpiryWheel::WheelEntry)};
+    // Wheel size below which a shard's wheel is never purged of stale entries.
+    static constexpr std::size_t mMinWheelPurge {1024};
+    // Entries compared per eviction by the sampled policies.
+    static constexpr std::size_t mEvictionSamples {5};
+    // Upper bound of index slots looked at per shard and CompactTick.
+    static constexpr std::size_t mCompactionBudget {4096};
+    // Bits of a SCAN cursor below the shard index, enough for any FlatIndex::Scan cursor.
+    static constexpr uint32_t mScanShardShift {48};
+    // Extra cost of an entry in the ordered index beyond its key bytes: tree node and key.
+    static constexpr std::size_t mOrderedEntryOverhead {64};
+
+    struct Stats
+    {
+        std::size_t mKeys {0};
+        std::size_t mUsedMemory {0};
+        // 0 when unbounded.
+        std::size_t mMaxMemory {0};
+        uint64_t mEvicted {0};
+        uint64_t mExpired {0};
+        EvictionPolicy mPolicy {EvictionPolicy::LRU};
+        // Bytes of slab chunks holding values, and of the slab pages mapped for them.
+        std::size_t mSlabUsed {0};
+        std::size_t mSlabAllocated {0};
+        uint64_t mCompacted {0};
+        // Slots of the shards' hash indexes, mKeys / mIndexSlots being their load factor.
+        std::size_t mIndexSlots {0};
+        // Batches the append-only log failed to write, and whether it stopped writing.
+        uint64_t mLogWriteErrors {0};
+        bool mLogFailed {false};
+    };
+
+    enum class CasResult
+    {
+        STORED,
+        NOT_FOUND,
+        // The entry's version was not the expected one.
+        CONFLICT
+    };
+
+    struct SnapshotEntry
+    {
+        std::string mKey;
+        ValueHandle mValue;
+        // Wall clock milliseconds since the Unix epoch, 0 when the key does not expire.
+        uint64_t mExpireAt;
+    };
+
+    // Keys from mFrom on (after it, when mExclusive, as when resuming from a cursor), below mTo
+    // unless empty, and starting with mPrefix.
+    struct RangeScan
+    {
+        std::string_view mFrom;
+        bool mExclusive {false};
+        std::string_view mTo;
+        std::string_view mPrefix;
+        std::size_t mLimit {0};
+    };
+
+private:
+    struct StringHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view aKey) const noexcept
+        {
+            return std::hash<std::string_view>{}(aKey);
+        }
+    };
+
+    struct Entry
+    {
+        Entry(ValueHandle aValue, uint32_t aAccess, uint64_t aVersion) : mValue{std::move(aValue)}, mVersion{aVersion}, mAccess{aAccess} {}
+
+        Entry(Entry&& aOther) noexcept
+            : mValue{std::move(aOther.mValue)}, mVersion{aOther.mVersion}, mExpiry{aOther.mExpiry}, mArm{aOther.mArm},
+              mAccess{aOther.mAccess.load(std::memory_order_relaxed)}
+        {
+        }
+
+        ValueHandle mValue;
+        // Changes with every write of the entry, for CAS.
+        uint64_t mVersion;
+        // Deadline in ticks of mExpiryTick since mEpoch, 0 when the key does not expire.
+        uint32_t mExpiry {0};
+        // Generation of the timer wheel entry armed for the key, 0 when none is.
+        uint32_t mArm {0};
+        // Eviction policy state, updated by readers under the shared lock (see AccessTracker).
+        mutable std::atomic<uint32_t> mAccess;
+    };
+
+    using Map = FlatIndex<CompactKey, Entry, StringHash>;
+
+    struct KeyLess
+    {
+        using is_transparent = void;
+
+        bool operator()(std::string_view aLeft, std::string_view aRight) const noexcept
+        {
+            return aLeft < aRight;
+        }
+    };
+
+    using OrderedKeys = std::set<CompactKey, KeyLess>;
+
+    // Aligned to a cache line so that the locks of neighbouring shards never share one.
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex mMutex;
+        // Declared before mMap, which returns its values to it when destroyed.
+        SlabArena mArena;
+        Map mMap;
+        // Same keys as mMap, in order; only filled with the ordered index enabled.
+        OrderedKeys mOrdered;
+        ExpiryWheel mWheel;
+        // Last arm generation handed out, and the wheel size that triggers the next purge.
+        uint32_t mArm {0};
+        std::size_t mPurgeAt {mMinWheelPurge};
+        uint64_t mExpired {0};
+        uint64_t mEvicted {0};
+        // Bytes charged to the shard, and the part of it already added to mUsedMemory.
+        int64_t mMemory {0};
+        int64_t mReported {0};
+        // Index slot the CLOCK hand points at, and the state of the sampling position generator.
+        std::size_t mHand {0};
+        uint64_t mSampleState {0};
+        // Next index slot looked at by CompactTick, and the values it moved.
+        std::size_t mCompactCursor {0};
+        uint64_t mCompacted {0};
+        // Last version given to an entry of the shard.
+        uint64_t mVersion {0};
+    };
+
+public:
+    explicit InMemoryDB(std::size_t aNrOfShards = DefaultNrOfShards())
+        : mNrOfShards{std::bit_ceil(aNrOfShards == 0 ? std::size_t{1} : aNrOfShards)},
+          mShardShift{64 - static_cast<uint32_t>(std::countr_zero(mNrOfShards))},
+          mShards{std::make_unique<Shard[]>(mNrOfShards)},
+          mEpoch{std::chrono::steady_clock::now()},
+          mWallEpoch{std::chrono::system_clock::now()},
+          mReportStep{ReportStepFor(0)}
+    {
+        // A million versions per millisecond before a restart could hand out one seen before.
+        const uint64_t lFirstVersion = WallClockMs(mWallEpoch) << 20;
+        for(std::size_t i = 0; i < mNrOfShards; ++i)
+        {
+            mShards[i].mSampleState = i * 0x9E3779B97F4A7C15ull + 1;
+            mShards[i].mVersion = lFirstVersion;
+        }
+    }
+
+    InMemoryDB(const InMemoryDB&) = delete;
+    InMemoryDB& operator=(const InMemoryDB&) = delete;
+
+    // Bounds the memory charged to entries to aMaxMemory bytes (0 for unbounded) and selects the
+    // eviction policy. Must be called before the store is shared between threads.
+    void ConfigureEviction(std::size_t aMaxMemory, EvictionPolicy aPolicy)
+    {
+        mMaxMemory = aMaxMemory;
+        mPolicy = aPolicy;
+        mReportStep = ReportStepFor(aMaxMemory);
+    }
+
+    // Values of at least aThreshold bytes (0 to disable) are stored LZ4 compressed when that
+    // saves at least an eighth of their size. Like ConfigureEviction, must be called before the
+    // store is shared.
+    void ConfigureCompression(std::size_t aThreshold)
+    {
+        mCompressionThreshold = aThreshold;
+    }
+
+    // Keeps the keys of every shard in order too, for RangeScanRequest. Like ConfigureEviction,
+    // must be called before the store is filled or shared.
+    void ConfigureOrderedIndex(bool aEnabled)
+    {
+        mOrderedIndex = aEnabled;
+    }
+
+    bool OrderedIndexEnabled() const
+    {
+        return mOrderedIndex;
+    }
+
+    // Starts queueing every change to aLog (nullptr to stop). Like ConfigureEviction, must be
+    // called before the store is shared; a log being replayed must not be attached yet.
+    void AttachLog(AppendLog* aLog)
+    {
+        mLog = aLog;
+    }
+
+    // Applies one record of a log being replayed. Safe to call concurrently.
+    void ReplayRecord(const LogRecord& aRecord)
+    {
+        uint64_t lTtlMs {0};
+        if(aRecord.mExpireAt != 0)
+        {
+            const uint64_t lNow = WallClockMs(std::chrono::system_clock::now());
+            if(aRecord.mExpireAt <= lNow)
+            {
+                // Expired while the server was down; drop what an earlier record stored.
+                DelRequest(aRecord.mKey);
+                return;
+            }
+            lTtlMs = aRecord.mExpireAt - lNow;
+        }
+
+        switch(aRecord.mOp)
+        {
+            case LogOp::SET:
+                SetRequest(aRecord.mKey, aRecord.mValue, lTtlMs);
+                break;
+            case LogOp::SET_LZ4:
+                Set(aRecord.mKey, aRecord.mValue, lTtlMs, Codec::LZ4);
+                break;
+            case LogOp::SET_INT64:
+                if(aRecord.mValue.size() == sizeof(int64_t))
+                {
+                    Set(aRecord.mKey, aRecord.mValue, lTtlMs, Codec::INT64);
+                }
+                break;
+            case LogOp::DEL:
+                DelRequest(aRecord.mKey);
+                break;
+            case LogOp::EXPIRE:
+                ExpireRequest(aRecord.mKey, lTtlMs);
+                break;
+        }
+    }
+
+    // aValue is copied into the shard's slab, or, when too large for a slab class and passed as
+    // an rvalue, moved into the store; a small aValue is left untouched, so the caller can reuse
+    // its buffer. A non zero aTtlMs makes the key expire, zero stores it without expiry
+    // (dropping a previous TTL).
+    std::variant<bool, std::string> SetRequest(std::string_view aKey, std::string&& aValue, uint64_t aTtlMs = 0)
+    {
+        return Set(aKey, std::move(aValue), aTtlMs);
+    }
+
+    std::variant<bool, std::string> SetRequest(std::string_view aKey, std::string_view aValue, uint64_t aTtlMs = 0)
+    {
+        return Set(aKey, aValue, aTtlMs);
+    }
+
+    // Keeps string literals from being ambiguous between the two overloads above.
+    std::variant<bool, std::string> SetRequest(std::string_view aKey, const char* aValue, uint64_t aTtlMs = 0)
+    {
+        return Set(aKey, std::string_view(aValue), aTtlMs);
+    }
+
+    // Returns nullptr when the key is not in the store; otherwise aVersion, when given, receives
+    // the entry's version.
+    ValueHandle GetRequest(std::string_view aKey, uint64_t* aVersion = nullptr) const
+    {
+        const std::size_t lHash = HashOf(aKey);
+        const Shard& lShard = ShardFor(lHash);
+        std::shared_lock lLock{lShard.mMutex};
+        auto lIt = lShard.mMap.find(aKey, lHash);
+        if(lIt == lShard.mMap.end() || IsExpired(lIt->second))
+        {
+            return nullptr;
+        }
+        Touch(lIt->second);
+        if(aVersion != nullptr)
+        {
+            *aVersion = lIt->second.mVersion;
+        }
+        return lIt->second.mValue;
+    }
+
+    // Read-modify-write ops. Each one is atomic: it runs under the key's shard lock from reading
+    // the entry to storing the result. A missing key has no TTL; a changed value keeps its TTL
+    // except where the op takes aTtlMs, as SET does. aVersion, when given, receives the entry's
+    // version afterwards, 0 for a key still missing.
+
+    // Adds aDelta to the integer stored under aKey, 0 when the key is missing, and returns the
+    // sum. Fails when the value is not a decimal integer or the sum would overflow 64 bits.
+    std::variant<int64_t, std::string> IncrByRequest(std::string_view aKey, int64_t aDelta, uint64_t* aVersion = nullptr)
+    {
+        int64_t lSum {0};
+        std::string lError;
+        auto lResult = ReadModifyWrite(aKey, aVersion, [&](const Entry* aCurrent, ValueHandle& aValue, uint32_t&, SlabArena& aArena){
+            int64_t lCurrent {0};
+            if(aCurrent != nullptr && ToInteger(*aCurrent->mValue, lCurrent) == false)
+            {
+                lError = "Value is not an integer";
+                return false;
+            }
+            if(__builtin_add_overflow(lCurrent, aDelta, &lSum))
+            {
+                lError = "Increment would overflow";
+                return false;
+            }
+            if(aCurrent != nullptr && aCurrent->mValue->UpdateInteger(lSum))
+            {
+                return true;
+            }
+            aValue = ValueHandle{Value::CreateInteger(aArena, lSum)};
+            return true;
+        });
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            return std::get<std::string>(lResult);
+        }
+        if(lError.empty() == false)
+        {
+            return lError;
+        }
+        return lSum;
+    }
+
+    // Appends aSuffix to the value under aKey, or stores it when the key is missing, and returns
+    // the new length. The value is copied whole, as values are immutable.
+    std::variant<std::size_t, std::string> AppendRequest(std::string_view aKey, std::string_view aSuffix, uint64_t* aVersion = nullptr)
+    {
+        std::size_t lLength {0};
+        auto lResult = ReadModifyWrite(aKey, aVersion, [&](const Entry* aCurrent, ValueHandle& aValue, uint32_t&, SlabArena& aArena){
+            std::string lBytes;
+            if(aCurrent != nullptr)
+            {
+                lBytes.resize(aCurrent->mValue->DecodedSize());
+                if(aCurrent->mValue->Decode(lBytes.data()) == false)
+                {
+                    throw std::runtime_error("Stored value failed to decompress");
+                }
+            }
+            lBytes.append(aSuffix);
+            lLength = lBytes.size();
+            if(Fits(aKey, lLength) == false)
+            {
+                throw std::length_error("Value exceeds the memory limit");
+            }
+            aValue = MakeValue(aArena, std::move(lBytes), Codec::NONE);
+            return true;
+        });
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            return std::get<std::string>(lResult);
+        }
+        return lLength;
+    }
+
+    // Stores aValue like SetRequest and hands back the value it replaced, nullptr when the key
+    // was missing.
+    std::variant<ValueHandle, std::string> GetSetRequest(std::string_view aKey, std::string&& aValue, uint64_t aTtlMs = 0, uint64_t* aVersion = nullptr)
+    {
+        ValueHandle lPrevious;
+        ValueHandle lValue;
+        const uint32_t lDeadline = DeadlineFor(aTtlMs);
+        auto lResult = PrepareAndModify(aKey, std::move(aValue), lValue, aVersion, [&](const Entry* aCurrent, ValueHandle& aStored, uint32_t& aDeadline, SlabArena&){
+            if(aCurrent != nullptr)
+            {
+                lPrevious = aCurrent->mValue;
+            }
+            aStored = std::move(lValue);
+            aDeadline = lDeadline;
+            return true;
+        });
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            return std::get<std::string>(lResult);
+        }
+        return lPrevious;
+    }
+
+    // Stores aValue like SetRequest, but only when aKey is missing. Returns whether it did.
+    std::variant<bool, std::string> SetIfAbsentRequest(std::string_view aKey, std::string&& aValue, uint64_t aTtlMs = 0, uint64_t* aVersion = nullptr)
+    {
+        ValueHandle lValue;
+        const uint32_t lDeadline = DeadlineFor(aTtlMs);
+        return PrepareAndModify(aKey, std::move(aValue), lValue, aVersion, [&](const Entry* aCurrent, ValueHandle& aStored, uint32_t& aDeadline, SlabArena&){
+            if(aCurrent != nullptr)
+            {
+                return false;
+            }
+            aStored = std::move(lValue);
+            aDeadline = lDeadline;
+            return true;
+        });
+    }
+
+    // Stores aValue like SetRequest, but only when the entry's version is aExpectedVersion. On
+    // CONFLICT aVersion receives the entry's current version.
+    std::variant<CasResult, std::string> CompareAndSetRequest(std::string_view aKey, uint64_t aExpectedVersion, std::string&& aValue, uint64_t aTtlMs = 0, uint64_t* aVersion = nullptr)
+    {
+        CasResult lOutcome {CasResult::STORED};
+        ValueHandle lValue;
+        const uint32_t lDeadline = DeadlineFor(aTtlMs);
+        auto lResult = PrepareAndModify(aKey, std::move(aValue), lValue, aVersion, [&](const Entry* aCurrent, ValueHandle& aStored, uint32_t& aDeadline, SlabArena&){
+            if(aCurrent == nullptr || aCurrent->mVersion != aExpectedVersion)
+            {
+                lOutcome = aCurrent == nullptr ? CasResult::NOT_FOUND : CasResult::CONFLICT;
+                return false;
+            }
+            aStored = std::move(lValue);
+            aDeadline = lDeadline;
+            return true;
+        });
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            return std::get<std::string>(lResult);
+        }
+        return lOutcome;
+    }
+
+    // Returns true when the key was present.
+    bool DelRequest(std::string_view aKey)
+    {
+        ValueHandle lRemoved {};
+        const std::size_t lHash = HashOf(aKey);
+        Shard& lShard = ShardFor(lHash);
+        std::unique_lock lLock{lShard.mMutex};
+        auto lIt = lShard.mMap.find(aKey, lHash);
+        if(lIt == lShard.mMap.end())
+        {
+            return false;
+        }
+        const bool lExpired = IsExpired(lIt->second);
+        lRemoved = Erase(lShard, lIt);
+        lLock.unlock();
+        return lExpired == false;
+    }
+
+    bool ExistsRequest(std::string_view aKey) const
+    {
+        const std::size_t lHash = HashOf(aKey);
+        const Shard& lShard = ShardFor(lHash);
+        std::shared_lock lLock{lShard.mMutex};
+        auto lIt = lShard.mMap.find(aKey, lHash);
+        return lIt != lShard.mMap.end() && IsExpired(lIt->second) == false;
+    }
+
+    // Sets (aTtlMs > 0) or removes (aTtlMs == 0) the TTL of an existing key. Returns false when
+    // the key is not in the store.
+    bool ExpireRequest(std::string_view aKey, uint64_t aTtlMs)
+    {
+        ValueHandle lRemoved {};
+        const uint32_t lDeadline = DeadlineFor(aTtlMs);
+        const std::size_t lHash = HashOf(aKey);
+        Shard& lShard = ShardFor(lHash);
+        std::unique_lock lLock{lShard.mMutex};
+        auto lIt = lShard.mMap.find(aKey, lHash);
+        if(lIt == lShard.mMap.end())
+        {
+            return false;
+        }
+        if(IsExpired(lIt->second))
+        {
+            lRemoved = Erase(lShard, lIt);
+            return false;
+        }
+
+        Arm(lShard, lHash, lIt->second, lDeadline);
+        if(mLog != nullptr)
+        {
+            mLog->Expire(IndexOf(lShard), aKey, WallDeadline(lDeadline));
+        }
+        return true;
+    }
+
+    // Remaining time to live in milliseconds, -1 for a key without expiry, nullopt when the key
+    // is not in the store.
+    std::optional<int64_t> TtlRequest(std::string_view aKey) const
+    {
+        const std::size_t lHash = HashOf(aKey);
+        const Shard& lShard = ShardFor(lHash);
+        std::shared_lock lLock{lShard.mMutex};
+        auto lIt = lShard.mMap.find(aKey, lHash);
+        if(lIt == lShard.mMap.end())
+        {
+            return std::nullopt;
+        }
+
+        const uint32_t lExpiry = lIt->second.mExpiry;
+        if(lExpiry == 0)
+        {
+            return -1;
+        }
+        const uint32_t lNow = NowTick();
+        if(lExpiry <= lNow)
+        {
+            return std::nullopt;
+        }
+        return static_cast<int64_t>(lExpiry - lNow) * mExpiryTick.count();
+    }
+
+    // Batch operations. Keys are grouped by shard so that each shard lock is taken once per
+    // batch, whatever the number of keys; results are in the order of aKeys.
+    void MultiGetRequest(std::span<const std::string_view> aKeys, std::vector<ValueHandle>& aValues) const
+    {
+        aValues.assign(aKeys.size(), nullptr);
+        const uint32_t lNow = NowTick();
+        ForEachShardGroup(aKeys, [&](Shard& aShard, std::span<const BatchSlot> aSlots){
+            std::shared_lock lLock{aShard.mMutex};
+            for(const BatchSlot& lSlot : aSlots)
+            {
+                auto lIt = aShard.mMap.find(aKeys[lSlot.mIndex], lSlot.mHash);
+                if(lIt != aShard.mMap.end() && IsExpired(lIt->second, lNow) == false)
+                {
+                    Touch(lIt->second);
+                    aValues[lSlot.mIndex] = lIt->second.mValue;
+                }
+            }
+        });
+    }
+
+    // aValues[i] is stored under aKeys[i], moved or copied as by SetRequest. When a key repeats, the last one wins.
+    std::variant<bool, std::string> MultiSetRequest(std::span<const std::string_view> aKeys, std::span<std::string> aValues, uint64_t aTtlMs = 0)
+    {
+        try
+        {
+            // Checked up front so a batch is either stored as a whole or not at all.
+            for(std::size_t i = 0; i < aKeys.size(); ++i)
+            {
+                if(Fits(aKeys[i], aValues[i].size()) == false)
+                {
+                    return std::string("Value exceeds the memory limit");
+                }
+            }
+
+            std::vector<ValueHandle> lValues(aValues.size());
+            // Replaced values end up in lValues, evicted ones in lReleased; both are released
+            // after every lock is dropped.
+            std::vector<ValueHandle> lReleased;
+            std::optional<std::size_t> lOverBudgetShard;
+            const uint32_t lDeadline = DeadlineFor(aTtlMs);
+            ForEachShardGroup(aKeys, [&](Shard& aShard, std::span<const BatchSlot> aSlots){
+                for(const BatchSlot& lSlot : aSlots)
+                {
+                    lValues[lSlot.mIndex] = MakeValue(aShard.mArena, std::move(aValues[lSlot.mIndex]), Codec::NONE);
+                }
+                std::unique_lock lLock{aShard.mMutex};
+                for(const BatchSlot& lSlot : aSlots)
+                {
+                    const CompactKey& lKey = Store(aShard, aKeys[lSlot.mIndex], lSlot.mHash, lValues[lSlot.mIndex], lDeadline);
+                    if(Evict(aShard, &lKey, lReleased))
+                    {
+                        lOverBudgetShard = lSlot.mShard;
+                    }
+                }
+            });
+            if(lOverBudgetShard)
+            {
+                EvictFromOtherShards(*lOverBudgetShard, lReleased);
+            }
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            LOG_ERROR("Error setting key-value pairs in DB: ", e.what());
+            return std::string(e.what());
+        }
+    }
+
+    // aFound[i] tells whether aKeys[i] was present. Returns the number of keys removed.
+    std::size_t MultiDelRequest(std::span<const std::string_view> aKeys, std::vector<bool>& aFound)
+    {
+        std::size_t lRemoved {0};
+        std::vector<ValueHandle> lReleased;
+        aFound.assign(aKeys.size(), false);
+        const uint32_t lNow = NowTick();
+        ForEachShardGroup(aKeys, [&](Shard& aShard, std::span<const BatchSlot> aSlots){
+            std::unique_lock lLock{aShard.mMutex};
+            for(const BatchSlot& lSlot : aSlots)
+            {
+                auto lIt = aShard.mMap.find(aKeys[lSlot.mIndex], lSlot.mHash);
+                if(lIt != aShard.mMap.end())
+                {
+                    const bool lExpired = IsExpired(lIt->second, lNow);
+                    lReleased.push_back(Erase(aShard, lIt));
+                    aFound[lSlot.mIndex] = lExpired == false;
+                    lRemoved += lExpired == false;
+                }
+            }
+        });
+        return lRemoved;
+    }
+
+    // Appends to aKeys, in order, up to aScan.mLimit live keys matching aScan; fewer means the
+    // scan reached its end. Shards are visited one after the other, each under its shared lock
+    // only while its candidates are copied; a shard contributes no key that sorts after the
+    // last of a full result, so each one copies at most mLimit keys. Requires the ordered index.
+    void RangeScanRequest(const RangeScan& aScan, std::vector<std::string>& aKeys) const
+    {
+        std::vector<std::string> lResult;
+        std::vector<std::string> lShardKeys;
+        std::vector<std::string> lMerged;
+        const std::string_view lFrom = std::max(aScan.mFrom, aScan.mPrefix);
+        for(std::size_t i = 0; i < mNrOfShards && aScan.mLimit > 0; ++i)
+        {
+            const Shard& lShard = mShards[i];
+            {
+                std::shared_lock lLock{lShard.mMutex};
+                const uint32_t lNow = NowTick();
+                auto lIt = aScan.mExclusive && lFrom == aScan.mFrom ? lShard.mOrdered.upper_bound(lFrom) : lShard.mOrdered.lower_bound(lFrom);
+                for(; lIt != lShard.mOrdered.end() && lShardKeys.size() < aScan.mLimit; ++lIt)
+                {
+                    const std::string_view lKey = lIt->View();
+                    if((aScan.mTo.empty() == false && lKey >= aScan.mTo) || lKey.starts_with(aScan.mPrefix) == false ||
+                       (lResult.size() == aScan.mLimit && lKey >= lResult.back()))
+                    {
+                        break;
+                    }
+                    auto lEntry = lShard.mMap.find(lKey, HashOf(lKey));
+                    if(lEntry != lShard.mMap.end() && IsExpired(lEntry->second, lNow) == false)
+                    {
+                        lShardKeys.emplace_back(lKey);
+                    }
+                }
+            }
+
+            lMerged.clear();
+            std::merge(std::make_move_iterator(lResult.begin()), std::make_move_iterator(lResult.end()),
+                       std::make_move_iterator(lShardKeys.begin()), std::make_move_iterator(lShardKeys.end()), std::back_inserter(lMerged));
+            lMerged.resize(std::min(lMerged.size(), aScan.mLimit));
+            lResult.swap(lMerged);
+            lShardKeys.clear();
+        }
+        std::move(lResult.begin(), lResult.end(), std::back_inserter(aKeys));
+    }
+
+    // One step of a walk over every key, for SCAN: starting at aCursor (0 to begin), appends the
+    // live keys matching aPattern (all when empty) and returns the cursor to continue from, 0
+    // once the walk is complete. A step stops once it looked at aCount entries or visited ten
+    // times as many buckets, so its cost is bounded however sparse the index or selective the
+    // pattern; it may return no keys before the end. The cursor holds the shard in its top
+    // bits and that shard's FlatIndex::Scan cursor below, so nothing is kept between steps and
+    // every key present for the whole walk is returned at least once. Shards are read-locked
+    // one at a time.
+    uint64_t ScanRequest(uint64_t aCursor, std::string_view aPattern, std::size_t aCount, std::vector<std::string>& aKeys) const
+    {
+        std::size_t lShardIndex = static_cast<std::size_t>(aCursor >> mScanShardShift);
+        std::size_t lBucket = static_cast<std::size_t>(aCursor & ((uint64_t{1} << mScanShardShift) - 1));
+        const std::size_t lMaxBuckets = std::max<std::size_t>(aCount, 1) * 10;
+        std::size_t lLookedAt {0};
+        std::size_t lBuckets {0};
+        while(lShardIndex < mNrOfShards && lLookedAt < aCount && lBuckets < lMaxBuckets)
+        {
+            const Shard& lShard = mShards[lShardIndex];
+            {
+                std::shared_lock lLock{lShard.mMutex};
+                const uint32_t lNow = NowTick();
+                do
+                {
+                    lBucket = lShard.mMap.Scan(lBucket, [&](const Map::value_type& aEntry){
+                        ++lLookedAt;
+                        if(IsExpired(aEntry.second, lNow) == false && (aPattern.empty() || GlobMatch(aPattern, aEntry.first.View())))
+                        {
+                            aKeys.emplace_back(aEntry.first.View());
+                        }
+                    });
+                    ++lBuckets;
+                } while(lBucket != 0 && lLookedAt < aCount && lBuckets < lMaxBuckets);
+            }
+            if(lBucket == 0)
+            {
+                ++lShardIndex;
+            }
+        }
+        return lShardIndex < mNrOfShards ? (uint64_t{lShardIndex} << mScanShardShift) | lBucket : 0;
+    }
+
+    // Active expiry: advances every shard's timer wheel to now and removes the keys that are
+    // due, looking at no more than mExpiryBudget wheel entries per shard so that no shard lock
+    // is held for long. Returns the number of keys removed.
+    std::size_t ExpireTick()
+    {
+        std::size_t lExpired {0};
+        std::vector<ValueHandle> lReleased;
+        for(std::size_t i = 0; i < mNrOfShards; ++i)
+        {
+            Shard& lShard = mShards[i];
+            std::unique_lock lLock{lShard.mMutex};
+            const uint32_t lNow = NowTick();
+            mClock.store(lNow, std::memory_order_relaxed);
+            const std::size_t lScheduled = lShard.mWheel.Size();
+            lShard.mWheel.Advance(lNow, mExpiryBudget, [&](std::size_t aHash, uint32_t aArm) -> uint32_t {
+                auto lIt = FindArmed(lShard, aHash, aArm);
+                if(lIt == lShard.mMap.end())
+                {
+                    return 0;
+                }
+                if(IsExpired(lIt->second, lNow))
+                {
+                    lReleased.push_back(Erase(lShard, lIt));
+                    ++lShard.mExpired;
+                    ++lExpired;
+                    return 0;
+                }
+                return lIt->second.mExpiry;
+            });
+            Account(lShard, (static_cast<int64_t>(lShard.mWheel.Size()) - static_cast<int64_t>(lScheduled)) * static_cast<int64_t>(mWheelEntryCharge));
+            // Also finishes a resize of the index when writes to the shard stopped mid way.
+            lShard.mMap.Migrate(mExpiryBudget);
+            lLock.unlock();
+            lReleased.clear();
+        }
+        return lExpired;
+    }
+
+    // Compaction: once a shard's arena has marked its sparse pages (see SlabArena), walks the
+    // shard's entries and copies the values sitting on those pages into fresh chunks, looking at
+    // no more than mCompactionBudget entries per shard and call. The old chunks are released
+    // outside the lock; values still held by readers keep their page until they are dropped.
+    // Returns the number of values moved.
+    std::size_t CompactTick()
+    {
+        std::size_t lMoved {0};
+        std::vector<ValueHandle> lReleased;
+        for(std::size_t i = 0; i < mNrOfShards; ++i)
+        {
+            Shard& lShard = mShards[i];
+            if(lShard.mArena.EvacuatingPages() == 0 && lShard.mArena.BeginCompaction() == 0)
+            {
+                continue;
+            }
+
+            std::unique_lock lLock{lShard.mMutex};
+            Map& lMap = lShard.mMap;
+            const std::size_t lNrOfSlots = lMap.SlotCount();
+            for(std::size_t lStep = 0; lStep < lNrOfSlots && lStep < mCompactionBudget; ++lStep)
+            {
+                auto lIt = lMap.At(lShard.mCompactCursor++ % lNrOfSlots);
+                if(lIt != lMap.end() && lIt->second.mValue->Evacuating())
+                {
+                    ValueHandle& lValue = lIt->second.mValue;
+                    ValueHandle lCopy {Value::Create(lShard.mArena, std::string_view(*lValue), lValue->GetCodec())};
+                    lValue.swap(lCopy);
+                    lReleased.push_back(std::move(lCopy));
+                    ++lShard.mCompacted;
+                    ++lMoved;
+                }
+            }
+            lLock.unlock();
+            lReleased.clear();
+        }
+        return lMoved;
+    }
+
+    // Calls aVisitor(std::span<const SnapshotEntry>) once per shard with the shard's live
+    // entries. Each shard is only held, shared, while its keys and value handles are copied;
+    // values are immutable, so the visitor sees the shard as it was at that moment while
+    // writes carry on.
+    template<typename Visitor>
+    void ForEachShardCopy(Visitor&& aVisitor) const
+    {
+        std::vector<SnapshotEntry> lEntries;
+        for(std::size_t i = 0; i < mNrOfShards; ++i)
+        {
+            {
+                const Shard& lShard = mShards[i];
+                std::shared_lock lLock{lShard.mMutex};
+                const uint32_t lNow = NowTick();
+                lEntries.reserve(lShard.mMap.size());
+                for(const auto& [lKey, lEntry] : lShard.mMap)
+                {
+                    if(IsExpired(lEntry, lNow) == false)
+                    {
+                        lEntries.push_back({std::string(lKey.View()), lEntry.mValue, WallDeadline(lEntry.mExpiry)});
+                    }
+                }
+            }
+            aVisitor(std::span<const SnapshotEntry>(lEntries));
+            lEntries.clear();
+        }
+    }
+
+    Stats GetStats() const
+    {
+        Stats lStats;
+        lStats.mMaxMemory = mMaxMemory;
+        lStats.mPolicy = mPolicy;
+        for(std::size_t i = 0; i < mNrOfShards; ++i)
+        {
+            std::shared_lock lLock{mShards[i].mMutex};
+            lStats.mKeys += mShards[i].mMap.size();
+            lStats.mUsedMemory += static_cast<std::size_t>(mShards[i].mMemory);
+            lStats.mEvicted += mShards[i].mEvicted;
+            lStats.mExpired += mShards[i].mExpired;
+            lStats.mCompacted += mShards[i].mCompacted;
+            lStats.mSlabUsed += mShards[i].mArena.UsedBytes();
+            lStats.mSlabAllocated += mShards[i].mArena.AllocatedBytes();
+            lStats.mIndexSlots += mShards[i].mMap.bucket_count();
+        }
+        if(mLog != nullptr)
+        {
+            lStats.mLogWriteErrors = mLog->WriteErrors();
+            lStats.mLogFailed = mLog->Failed();
+        }
+        return lStats;
+    }
+
+    std::size_t Size() const
+    {
+        std::size_t lSize {0};
+        for(std::size_t i = 0; i < mNrOfShards; ++i)
+        {
+            std::shared_lock lLock{mShards[i].mMutex};
+            lSize += mShards[i].mMap.size();
+        }
+        return lSize;
+    }
+
+    std::size_t NrOfShards() const
+    {
+        return mNrOfShards;
+    }
+
+    // A few shards per core keeps the probability of two threads hitting the same lock low.
+    static std::size_t DefaultNrOfShards()
+    {
+        const std::size_t lNrOfCores = std::max(1u, std::thread::hardware_concurrency());
+        return std::bit_ceil(lNrOfCores * 8);
+    }
+
+private:
+    uint32_t NowTick() const
+    {
+        return 1 + static_cast<uint32_t>((std::chrono::steady_clock::now() - mEpoch) / mExpiryTick);
+    }
+
+    uint32_t DeadlineFor(uint64_t aTtlMs) const
+    {
+        if(aTtlMs == 0)
+        {
+            return 0;
+        }
+        const uint64_t lTicks = (std::min(aTtlMs, mMaxTtlMs) + mExpiryTick.count() - 1) / mExpiryTick.count();
+        return NowTick() + static_cast<uint32_t>(lTicks);
+    }
+
+    static uint64_t WallClockMs(std::chrono::system_clock::time_point aTime)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(aTime.time_since_epoch()).count());
+    }
+
+    // Wall clock time, in milliseconds since the Unix epoch, at which a deadline tick is reached.
+    uint64_t WallDeadline(uint32_t aDeadline) const
+    {
+        if(aDeadline == 0)
+        {
+            return 0;
+        }
+        return WallClockMs(mWallEpoch) + static_cast<uint64_t>(aDeadline - 1) * mExpiryTick.count();
+    }
+
+    bool IsExpired(const Entry& aEntry) const
+    {
+        return aEntry.mExpiry != 0 && aEntry.mExpiry <= NowTick();
+    }
+
+    static bool IsExpired(const Entry& aEntry, uint32_t aNow)
+    {
+        return aEntry.mExpiry != 0 && aEntry.mExpiry <= aNow;
+    }
+
+    // Bytes is std::string (moved from) or std::string_view, see Value::Create. aCodec is the
+    // codec aBytes are already encoded with.
+    template<typename Bytes>
+    std::variant<bool, std::string> Set(std::string_view aKey, Bytes&& aBytes, uint64_t aTtlMs, Codec aCodec = Codec::NONE)
+    {
+        try
+        {
+            if(Fits(aKey, aBytes.size()) == false)
+            {
+                return std::string("Value exceeds the memory limit");
+            }
+
+            const uint32_t lDeadline = DeadlineFor(aTtlMs);
+            const std::size_t lHash = HashOf(aKey);
+            const std::size_t lShardIndex = ShardIndex(lHash);
+            Shard& lShard = mShards[lShardIndex];
+            // Allocated before the shard is locked, the arena has a lock of its own.
+            ValueHandle lValue = MakeValue(lShard.mArena, std::forward<Bytes>(aBytes), aCodec);
+            // The previous value and evicted ones are released after the lock is dropped.
+            std::vector<ValueHandle> lReleased;
+            bool lOverBudget {false};
+            {
+                std::unique_lock lLock{lShard.mMutex};
+                const CompactKey& lKey = Store(lShard, aKey, lHash, lValue, lDeadline);
+                lOverBudget = Evict(lShard, &lKey, lReleased);
+            }
+            if(lOverBudget)
+            {
+                EvictFromOtherShards(lShardIndex, lReleased);
+            }
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            LOG_ERROR("Error setting key-value pair in DB: ", e.what());
+            return std::string(e.what());
+        }
+    }
+
+    // Compresses values over the threshold, outside any shard lock; keeps the bytes as they are
+    // when compression does not pay.
+    template<typename Bytes>
+    ValueHandle MakeValue(SlabArena& aArena, Bytes&& aBytes, Codec aCodec) const
+    {
+        if(aCodec == Codec::NONE && mCompressionThreshold != 0 && aBytes.size() >= mCompressionThreshold)
+        {
+            thread_local std::string lCompressed;
+            CompressLz4(aBytes, lCompressed);
+            if(lCompressed.size() <= aBytes.size() - aBytes.size() / 8)
+            {
+                return ValueHandle{Value::Create(aArena, std::string_view(lCompressed), Codec::LZ4)};
+            }
+        }
+        return ValueHandle{Value::Create(aArena, std::forward<Bytes>(aBytes), aCodec)};
+    }
+
+    // Runs aModify(const Entry* aCurrent, ValueHandle& aValue, uint32_t& aDeadline, SlabArena&)
+    // under the exclusive lock of aKey's shard, aCurrent being nullptr when the key is missing
+    // or expired and aDeadline starting as its deadline. When aModify returns true, aValue is
+    // stored with aDeadline, as by Set; left empty, it means aModify updated aCurrent's value in
+    // place. Returns whether anything was written, or what aModify or the store threw.
+    template<typename Modify>
+    std::variant<bool, std::string> ReadModifyWrite(std::string_view aKey, uint64_t* aVersion, Modify&& aModify)
+    {
+        try
+        {
+            const std::size_t lHash = HashOf(aKey);
+            const std::size_t lShardIndex = ShardIndex(lHash);
+            Shard& lShard = mShards[lShardIndex];
+            // The previous value and evicted ones are released after the lock is dropped.
+            ValueHandle lValue;
+            std::vector<ValueHandle> lReleased;
+            bool lOverBudget {false};
+            {
+                std::unique_lock lLock{lShard.mMutex};
+                auto lIt = lShard.mMap.find(aKey, lHash);
+                Entry* lCurrent = lIt != lShard.mMap.end() && IsExpired(lIt->second) == false ? &lIt->second : nullptr;
+                uint32_t lDeadline = lCurrent != nullptr ? lCurrent->mExpiry : 0;
+                if(aModify(static_cast<const Entry*>(lCurrent), lValue, lDeadline, lShard.mArena) == false)
+                {
+                    if(aVersion != nullptr)
+                    {
+                        *aVersion = lCurrent != nullptr ? lCurrent->mVersion : 0;
+                    }
+                    return false;
+                }
+
+                if(lValue == nullptr)
+                {
+                    lCurrent->mVersion = ++lShard.mVersion;
+                    Touch(*lCurrent);
+                    if(mLog != nullptr)
+                    {
+                        mLog->Set(IndexOf(lShard), aKey, lCurrent->mValue, WallDeadline(lCurrent->mExpiry));
+                    }
+                }
+                else
+                {
+                    const CompactKey& lKey = Store(lShard, aKey, lHash, lValue, lDeadline);
+                    lOverBudget = Evict(lShard, &lKey, lReleased);
+                }
+                if(aVersion != nullptr)
+                {
+                    *aVersion = lShard.mVersion;
+                }
+            }
+            if(lOverBudget)
+            {
+                EvictFromOtherShards(lShardIndex, lReleased);
+            }
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            return std::string(e.what());
+        }
+    }
+
+    // ReadModifyWrite of a write that brings its own value: aBytes is checked against the limit
+    // and made into aValue, for aModify to store, before the lock is taken.
+    template<typename Modify>
+    std::variant<bool, std::string> PrepareAndModify(std::string_view aKey, std::string&& aBytes, ValueHandle& aValue, uint64_t* aVersion, Modify&& aModify)
+    {
+        if(Fits(aKey, aBytes.size()) == false)
+        {
+            return std::string("Value exceeds the memory limit");
+        }
+        try
+        {
+            aValue = MakeValue(ShardFor(HashOf(aKey)).mArena, std::move(aBytes), Codec::NONE);
+        }
+        catch(const std::exception& e)
+        {
+            return std::string(e.what());
+        }
+        return ReadModifyWrite(aKey, aVersion, std::forward<Modify>(aModify));
+    }
+
+    // The value of an INT64 entry, or of one holding exactly the decimal digits of an int64_t,
+    // with an optional minus sign.
+    static bool ToInteger(const Value& aValue, int64_t& aInteger)
+    {
+        if(aValue.GetCodec() == Codec::INT64)
+        {
+            aInteger = aValue.Integer();
+            return true;
+        }
+        if(aValue.GetCodec() != Codec::NONE || aValue.Size() == 0 || aValue.Size() > Value::mMaxIntegerDigits)
+        {
+            return false;
+        }
+        const char* const lEnd = aValue.Data() + aValue.Size();
+        auto [lPtr, lError] = std::from_chars(aValue.Data(), lEnd, aInteger);
+        return lError == std::errc{} && lPtr == lEnd;
+    }
+
+    // Inserts or replaces aKey under the shard's exclusive lock, giving it a new version. The
+    // replaced value is swapped into aValue so the caller can release it outside the lock.
+    // Returns the stored key.
+    const CompactKey& Store(Shard& aShard, std::string_view aKey, std::size_t aHash, ValueHandle& aValue, uint32_t aDeadline)
+    {
+        auto lIt = aShard.mMap.find(aKey, aHash);
+        if(lIt == aShard.mMap.end())
+        {
+            if(mOrderedIndex)
+            {
+                aShard.mOrdered.emplace(aKey);
+            }
+            Account(aShard, static_cast<int64_t>(Charge(aKey, aValue->Size())));
+            lIt = aShard.mMap.emplace(aKey, aHash, Entry{std::move(aValue), AccessTracker::Initial(mPolicy, mClock.load(std::memory_order_relaxed)), ++aShard.mVersion});
+        }
+        else
+        {
+            Account(aShard, static_cast<int64_t>(aValue->Size()) - static_cast<int64_t>(lIt->second.mValue->Size()));
+            lIt->second.mValue.swap(aValue);
+            lIt->second.mVersion = ++aShard.mVersion;
+            Touch(lIt->second);
+        }
+        Arm(aShard, aHash, lIt->second, aDeadline);
+        if(mLog != nullptr)
+        {
+            mLog->Set(IndexOf(aShard), aKey, lIt->second.mValue, WallDeadline(aDeadline));
+        }
+        return lIt->first;
+    }
+
+    // Removes the entry under the shard's exclusive lock and hands back its value, to be
+    // released outside the lock.
+    ValueHandle Erase(Shard& aShard, Map::iterator aIt)
+    {
+        Account(aShard, -static_cast<int64_t>(Charge(aIt->first, aIt->second.mValue->Size())));
+        if(mLog != nullptr)
+        {
+            mLog->Del(IndexOf(aShard), aIt->first);
+        }
+        if(mOrderedIndex)
+        {
+            aShard.mOrdered.erase(aShard.mOrdered.find(aIt->first.View()));
+        }
+        ValueHandle lValue = std::move(aIt->second.mValue);
+        aShard.mMap.erase(aIt);
+        return lValue;
+    }
+
+    std::size_t Charge(std::string_view aKey, std::size_t aValueSize) const
+    {
+        const std::size_t lOrdered = mOrderedIndex ? mOrderedEntryOverhead + aKey.size() : 0;
+        return mEntryOverhead + aKey.size() + aValueSize + lOrdered;
+    }
+
+    bool Fits(std::string_view aKey, std::size_t aValueSize) const
+    {
+        return mMaxMemory == 0 || Charge(aKey, aValueSize) <= mMaxMemory;
+    }
+
+    // Tracks the shard's charge and publishes it to mUsedMemory once it drifted by a full step.
+    void Account(Shard& aShard, int64_t aDelta)
+    {
+        aShard.mMemory += aDelta;
+        const int64_t lUnreported = aShard.mMemory - aShard.mReported;
+        if(lUnreported >= mReportStep || lUnreported <= -mReportStep)
+        {
+            mUsedMemory.fetch_add(lUnreported, std::memory_order_relaxed);
+            aShard.mReported = aShard.mMemory;
+        }
+    }
+
+    // Published steps are kept to a small fraction of the budget, so the shared counter is never
+    // off by more than a few percent summed over all shards.
+    int64_t ReportStepFor(std::size_t aMaxMemory) const
+    {
+        constexpr int64_t lMaxStep {64 * 1024};
+        if(aMaxMemory == 0)
+        {
+            return lMaxStep;
+        }
+        return std::clamp<int64_t>(static_cast<int64_t>(aMaxMemory / (mNrOfShards * 32)), 1, lMaxStep);
+    }
+
+    bool OverBudget(const Shard& aShard) const
+    {
+        return mMaxMemory != 0 &&
+               mUsedMemory.load(std::memory_order_relaxed) + aShard.mMemory - aShard.mReported > static_cast<int64_t>(mMaxMemory);
+    }
+
+    void Touch(const Entry& aEntry) const
+    {
+        if(mMaxMemory != 0)
+        {
+            AccessTracker::Touch(aEntry.mAccess, mPolicy, mClock.load(std::memory_order_relaxed));
+        }
+    }
+
+    // Evicts from the shard, under its exclusive lock, until the store fits its budget. aKeep,
+    // the key just written, is never chosen. Returns true when the shard ran out of candidates
+    // while the store is still over budget.
+    bool Evict(Shard& aShard, const CompactKey* aKeep, std::vector<ValueHandle>& aReleased)
+    {
+        if(OverBudget(aShard) == false)
+        {
+            return false;
+        }
+
+        const uint32_t lNow = NowTick();
+        mClock.store(lNow, std::memory_order_relaxed);
+        while(OverBudget(aShard))
+        {
+            auto lVictim = PickVictim(aShard, aKeep, lNow);
+            if(lVictim == aShard.mMap.end())
+            {
+                return true;
+            }
+            if(IsExpired(lVictim->second, lNow))
+            {
+                ++aShard.mExpired;
+            }
+            else
+            {
+                ++aShard.mEvicted;
+            }
+            aReleased.push_back(Erase(aShard, lVictim));
+        }
+        return false;
+    }
+
+    // Slow path for a write into a shard with nothing left to evict: the other shards give up
+    // entries, one lock at a time.
+    void EvictFromOtherShards(std::size_t aShardIndex, std::vector<ValueHandle>& aReleased)
+    {
+        for(std::size_t i = 1; i < mNrOfShards; ++i)
+        {
+            Shard& lShard = mShards[(aShardIndex + i) & (mNrOfShards - 1)];
+            std::unique_lock lLock{lShard.mMutex};
+            if(Evict(lShard, nullptr, aReleased) == false)
+            {
+                return;
+            }
+        }
+    }
+
+    // Chooses the next entry to evict from the shard, an expired one when seen. Returns end()
+    // when the shard holds no entry but aKeep.
+    Map::iterator PickVictim(Shard& aShard, const CompactKey* aKeep, uint32_t aNow)
+    {
+        Map& lMap = aShard.mMap;
+        const std::size_t lNrOfSlots = lMap.SlotCount();
+        if(lNrOfSlots == 0)
+        {
+            return lMap.end();
+        }
+
+        if(mPolicy == EvictionPolicy::CLOCK)
+        {
+            // Within two turns of the hand every reference bit has been cleared once.
+            for(std::size_t lStep = 0; lStep < 2 * lNrOfSlots; ++lStep)
+            {
+                auto lIt = lMap.At(aShard.mHand++ % lNrOfSlots);
+                if(lIt == lMap.end() || &lIt->first == aKeep)
+                {
+                    continue;
+                }
+                if(IsExpired(lIt->second, aNow) || AccessTracker::SecondChance(lIt->second.mAccess) == false)
+                {
+                    return lIt;
+                }
+            }
+            return lMap.end();
+        }
+
+        // Sample a few entries from a random position, the worst scoring one is evicted.
+        aShard.mSampleState = aShard.mSampleState * 6364136223846793005ull + 1442695040888963407ull;
+        std::size_t lPosition = static_cast<std::size_t>(aShard.mSampleState >> 33) % lNrOfSlots;
+        auto lVictim = lMap.end();
+        std::size_t lSampled {0};
+        uint32_t lWorst {0};
+        for(std::size_t lStep = 0; lStep < lNrOfSlots && lSampled < mEvictionSamples; ++lStep)
+        {
+            auto lIt = lMap.At(lPosition);
+            lPosition = lPosition + 1 == lNrOfSlots ? 0 : lPosition + 1;
+            if(lIt == lMap.end() || &lIt->first == aKeep)
+            {
+                continue;
+            }
+            if(IsExpired(lIt->second, aNow))
+            {
+                return lIt;
+            }
+            const uint32_t lScore = AccessTracker::Score(lIt->second.mAccess.load(std::memory_order_relaxed), mPolicy, aNow);
+            if(lVictim == lMap.end() || lScore > lWorst)
+            {
+                lVictim = lIt;
+                lWorst = lScore;
+            }
+            ++lSampled;
+        }
+        return lVictim;
+    }
+
+    // Sets the entry's deadline. The wheel only needs a new entry when the key had none armed
+    // or the deadline moves earlier; a later deadline is picked up when the armed one fires.
+    // The entry armed before, if any, goes stale.
+    void Arm(Shard& aShard, std::size_t aHash, Entry& aEntry, uint32_t aDeadline)
+    {
+        const uint32_t lPrevious = aEntry.mExpiry;
+        aEntry.mExpiry = aDeadline;
+        if(aDeadline == 0)
+        {
+            aEntry.mArm = 0;
+            return;
+        }
+        if(aEntry.mArm != 0 && aDeadline >= lPrevious)
+        {
+            return;
+        }
+
+        if(++aShard.mArm == 0)
+        {
+            ++aShard.mArm;
+        }
+        aEntry.mArm = aShard.mArm;
+        aShard.mWheel.Schedule(aHash, aEntry.mArm, aDeadline);
+        Account(aShard, static_cast<int64_t>(mWheelEntryCharge));
+        if(aShard.mWheel.Size() >= aShard.mPurgeAt)
+        {
+            PurgeWheel(aShard);
+        }
+    }
+
+    // The entry a wheel entry was armed for, end() when it went stale. Arm generations are
+    // unique within the shard, so a match can only be the right key.
+    static Map::iterator FindArmed(Shard& aShard, std::size_t aHash, uint32_t aArm)
+    {
+        return aShard.mMap.find_if(aHash, [aArm](const Map::value_type& aSlot) { return aSlot.second.mArm == aArm; });
+    }
+
+    // Drops the wheel entries left behind by deletes, overwrites and moved deadlines. Runs once
+    // the wheel doubled since the last purge, so it costs a constant per scheduled entry and
+    // stale entries never outnumber the armed ones by much.
+    void PurgeWheel(Shard& aShard)
+    {
+        const std::size_t lDropped = aShard.mWheel.Purge([&](std::size_t aHash, uint32_t aArm) { return FindArmed(aShard, aHash, aArm) != aShard.mMap.end(); });
+        Account(aShard, -static_cast<int64_t>(lDropped * mWheelEntryCharge));
+        aShard.mPurgeAt = std::max(2 * aShard.mWheel.Size(), mMinWheelPurge);
+    }
+
+    struct BatchSlot
+    {
+        uint32_t mShard;
+        uint32_t mIndex;
+        std::size_t mHash;
+    };
+
+    // Calls aVisitor(Shard&, span of BatchSlot) once per shard touched by aKeys.
+    template<typename Visitor>
+    void ForEachShardGroup(std::span<const std::string_view> aKeys, Visitor&& aVisitor) const
+    {
+        std::vector<BatchSlot> lSlots;
+        lSlots.reserve(aKeys.size());
+        for(std::size_t i = 0; i < aKeys.size(); ++i)
+        {
+            const std::size_t lHash = HashOf(aKeys[i]);
+            lSlots.push_back({static_cast<uint32_t>(ShardIndex(lHash)), static_cast<uint32_t>(i), lHash});
+        }
+        // Stable, so repeated keys are applied in request order.
+        std::stable_sort(lSlots.begin(), lSlots.end(), [](const BatchSlot& aLeft, const BatchSlot& aRight){
+            return aLeft.mShard < aRight.mShard;
+        });
+
+        for(auto lBegin = lSlots.begin(); lBegin != lSlots.end();)
+        {
+            auto lEnd = std::find_if(lBegin, lSlots.end(), [lShard = lBegin->mShard](const BatchSlot& aSlot){
+                return aSlot.mShard != lShard;
+            });
+            aVisitor(mShards[lBegin->mShard], std::span<const BatchSlot>(lBegin, lEnd));
+            lBegin = lEnd;
+        }
+    }
+
+    // Computed once per key and request; the shard and its index both derive from it.
+    static std::size_t HashOf(std::string_view aKey)
+    {
+        return StringHash{}(aKey);
+    }
+
+    std::size_t ShardIndex(std::size_t aHash) const
+    {
+        // Fibonacci hashing on the top bits, so the shard choice does not correlate with the
+        // slot the shard's own index derives from the low bits of the same hash.
+        const uint64_t lHash = static_cast<uint64_t>(aHash) * 0x9E3779B97F4A7C15ull;
+        return mNrOfShards == 1 ? 0 : static_cast<std::size_t>(lHash >> mShardShift);
+    }
+
+    std::size_t IndexOf(const Shard& aShard) const
+    {
+        return static_cast<std::size_t>(&aShard - mShards.get());
+    }
+
+    Shard& ShardFor(std::size_t aHash)
+    {
+        return mShards[ShardIndex(aHash)];
+    }
+
+    const Shard& ShardFor(std::size_t aHash) const
+    {
+        return mShards[ShardIndex(aHash)];
+    }
+
+    const std::size_t mNrOfShards;
+    const uint32_t mShardShift;
+    std::unique_ptr<Shard[]> mShards;
+    const std::chrono::steady_clock::time_point mEpoch;
+    // Wall clock time of mEpoch, to log deadlines as absolute times.
+    const std::chrono::system_clock::time_point mWallEpoch;
+    AppendLog* mLog {nullptr};
+    std::size_t mMaxMemory {0};
+    EvictionPolicy mPolicy {EvictionPolicy::LRU};
+    std::size_t mCompressionThreshold {0};
+    bool mOrderedIndex {false};
+    int64_t mReportStep;
+    alignas(64) std::atomic<int64_t> mUsedMemory {0};
+    // Coarse clock of the access words, in ticks; refreshed by ExpireTick and by evictions so
+    // the read path never has to look at the system clock.
+    alignas(64) std::atomic<uint32_t> mClock {1};
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <optional>
+#include <cstdint>
+#include <cstring>
+#include "Checksum.h"
+
+// On-disk record of the append-only log:
+//   u32 body length | u32 CRC-32C of the body | body
+//   body = u8 op | u32 key length | key | u64 expire at (SET, EXPIRE) | value (SET, rest of body)
+// SET_LZ4 is a SET of a value kept LZ4 compressed in the store (see Compression.h); the value
+// is logged as stored and loaded back without being compressed again. SET_INT64 likewise logs
+// an integer kept natively, as its 8 bytes.
+// Integers are little-endian. "Expire at" is wall clock milliseconds since the Unix epoch, 0 for
+// no expiry, so a TTL keeps counting down while the server is down.
+
+enum class LogOp : uint8_t
+{
+    SET = 1,
+    DEL = 2,
+    EXPIRE = 3,
+    SET_LZ4 = 4,
+    SET_INT64 = 5
+};
+
+struct LogRecord
+{
+    LogOp mOp;
+    std::string_view mKey;
+    std::string_view mValue;
+    uint64_t mExpireAt {0};
+};
+
+inline constexpr std::size_t gLogRecordHeaderLength {8};
+
+template<typename T>
+inline void PutFixed(char* aOut, T aValue)
+{
+    for(std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        aOut[i] = static_cast<char>(aValue >> (8 * i));
+    }
+}
+
+template<typename T>
+inline T GetFixed(const char* aData)
+{
+    T lValue {0};
+    for(std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        lValue |= static_cast<T>(static_cast<unsigned char>(aData[i])) << (8 * i);
+    }
+    return lValue;
+}
+
+// Appends the framed record to aOut.
+inline void EncodeLogRecord(const LogRecord& aRecord, std::string& aOut)
+{
+    const bool lHasExpiry = aRecord.mOp != LogOp::DEL;
+    const std::size_t lBodyLength = 1 + 4 + aRecord.mKey.size() + (lHasExpiry ? 8 : 0) + aRecord.mValue.size();
+
+    const std::size_t lStart = aOut.size();
+    aOut.resize(lStart + gLogRecordHeaderLength + lBodyLength);
+    char* const lBody = aOut.data() + lStart + gLogRecordHeaderLength;
+    char* lOut = lBody;
+
+    *lOut++ = static_cast<char>(aRecord.mOp);
+    PutFixed<uint32_t>(lOut, static_cast<uint32_t>(aRecord.mKey.size()));
+    lOut += 4;
+    std::memcpy(lOut, aRecord.mKey.data(), aRecord.mKey.size());
+    lOut += aRecord.mKey.size();
+    if(lHasExpiry)
+    {
+        PutFixed<uint64_t>(lOut, aRecord.mExpireAt);
+        lOut += 8;
+    }
+    std::memcpy(lOut, aRecord.mValue.data(), aRecord.mValue.size());
+
+    PutFixed<uint32_t>(aOut.data() + lStart, static_cast<uint32_t>(lBodyLength));
+    PutFixed<uint32_t>(aOut.data() + lStart + 4, Crc32c(lBody, lBodyLength));
+}
+
+// Decodes a body whose checksum has been verified; nullopt when it is malformed. The record
+// points into aBody.
+inline std::optional<LogRecord> DecodeLogRecord(std::string_view aBody)
+{
+    if(aBody.size() < 5)
+    {
+        return std::nullopt;
+    }
+
+    LogRecord lRecord {static_cast<LogOp>(aBody[0]), {}, {}, 0};
+    const uint32_t lKeyLength = GetFixed<uint32_t>(aBody.data() + 1);
+    aBody.remove_prefix(5);
+    if(lKeyLength > aBody.size())
+    {
+        return std::nullopt;
+    }
+    lRecord.mKey = aBody.substr(0, lKeyLength);
+    aBody.remove_prefix(lKeyLength);
+
+    switch(lRecord.mOp)
+    {
+        case LogOp::SET:
+        case LogOp::SET_LZ4:
+        case LogOp::SET_INT64:
+        case LogOp::EXPIRE:
+            if(aBody.size() < 8 || (lRecord.mOp == LogOp::EXPIRE && aBody.size() != 8) ||
+               (lRecord.mOp == LogOp::SET_INT64 && aBody.size() != 16))
+            {
+                return std::nullopt;
+            }
+            lRecord.mExpireAt = GetFixed<uint64_t>(aBody.data());
+            lRecord.mValue = aBody.substr(8);
+            return lRecord;
+        case LogOp::DEL:
+            return aBody.empty() ? std::optional<LogRecord>{lRecord} : std::nullopt;
+    }
+    return std::nullopt;
+}
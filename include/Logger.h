@@ -0,0 +1,320 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <thread>
+#include <string_view>
+#include <charconv>
+#include <concepts>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+
+// Leveled asynchronous logger. Request threads format a message into a fixed size record and
+// push it on a bounded lock-free ring; a background thread drains the ring and does the actual
+// (blocking) output. A full ring drops the message and counts it instead of stalling the caller.
+//
+// Levels are filtered twice: messages below INMEMORYDB_LOG_LEVEL are removed at compile time,
+// arguments included, and the rest is checked against a runtime level. Release builds (NDEBUG)
+// compile DEBUG out; other builds keep it, but the runtime level starts at INFO whatever the
+// build, so DEBUG messages cost a relaxed load until enabled with --log-level debug.
+
+enum class LogLevel : uint8_t
+{
+    DEBUG = 0,
+    INFO = 1,
+    WARNING = 2,
+    ERROR = 3,
+    OFF = 4
+};
+
+#ifndef INMEMORYDB_LOG_LEVEL
+#ifdef NDEBUG
+#define INMEMORYDB_LOG_LEVEL 1
+#else
+#define INMEMORYDB_LOG_LEVEL 0
+#endif
+#endif
+
+inline constexpr LogLevel gCompileTimeLogLevel {static_cast<LogLevel>(INMEMORYDB_LOG_LEVEL)};
+
+inline constexpr std::string_view ToString(LogLevel aLevel)
+{
+    constexpr std::array<std::string_view, 5> lNames {"DEBUG", "INFO", "WARNING", "ERROR", "OFF"};
+    return lNames[static_cast<std::size_t>(aLevel)];
+}
+
+inline bool ParseLogLevel(std::string_view aName, LogLevel& aLevel)
+{
+    for(uint8_t i = 0; i <= static_cast<uint8_t>(LogLevel::OFF); ++i)
+    {
+        const std::string_view lName = ToString(static_cast<LogLevel>(i));
+        if(aName.size() == lName.size() && std::equal(aName.begin(), aName.end(), lName.begin(), [](char aLeft, char aRight){
+            return std::toupper(static_cast<unsigned char>(aLeft)) == aRight;
+        }))
+        {
+            aLevel = static_cast<LogLevel>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+class Logger
+{
+    static constexpr std::size_t mRecordTextLength {240};
+    static constexpr std::size_t mRingCapacity {4096};
+
+    struct LogRecord
+    {
+        std::chrono::system_clock::time_point mTime;
+        LogLevel mLevel;
+        uint16_t mLength;
+        char mText[mRecordTextLength];
+    };
+
+    // Bounded multi-producer ring, one sequence number per cell (Vyukov). mSequence == position
+    // means free for the producer claiming that position, position + 1 means ready to consume.
+    struct alignas(64) Cell
+    {
+        std::atomic<std::size_t> mSequence;
+        LogRecord mRecord;
+    };
+
+public:
+    static Logger& Instance()
+    {
+        static Logger lLogger;
+        return lLogger;
+    }
+
+    bool Enabled(LogLevel aLevel) const
+    {
+        return aLevel >= mLevel.load(std::memory_order_relaxed);
+    }
+
+    void SetLevel(LogLevel aLevel)
+    {
+        mLevel.store(aLevel, std::memory_order_relaxed);
+    }
+
+    LogLevel Level() const
+    {
+        return mLevel.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Dropped() const
+    {
+        return mDropped.load(std::memory_order_relaxed);
+    }
+
+    template<typename... Args>
+    void Write(LogLevel aLevel, const Args&... aArgs)
+    {
+        std::size_t lPosition = mHead.load(std::memory_order_relaxed);
+        Cell* lCell {nullptr};
+        for(;;)
+        {
+            lCell = &mCells[lPosition % mRingCapacity];
+            const std::size_t lSequence = lCell->mSequence.load(std::memory_order_acquire);
+            if(lSequence == lPosition)
+            {
+                if(mHead.compare_exchange_weak(lPosition, lPosition + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(lSequence < lPosition)
+            {
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                lPosition = mHead.load(std::memory_order_relaxed);
+            }
+        }
+
+        LogRecord& lRecord = lCell->mRecord;
+        lRecord.mTime = std::chrono::system_clock::now();
+        lRecord.mLevel = aLevel;
+        char* lOut = lRecord.mText;
+        char* const lEnd = lRecord.mText + mRecordTextLength;
+        ((lOut = Append(lOut, lEnd, aArgs)), ...);
+        lRecord.mLength = static_cast<uint16_t>(lOut - lRecord.mText);
+        lCell->mSequence.store(lPosition + 1, std::memory_order_release);
+
+        // Pairs with the fence in Drain: either the writer sees this record or we see it asleep.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(mSleeping.load(std::memory_order_relaxed))
+        {
+            mWakeups.fetch_add(1);
+            mWakeups.notify_one();
+        }
+    }
+
+    ~Logger()
+    {
+        mRunning.store(false);
+        mWakeups.fetch_add(1);
+        mWakeups.notify_one();
+        if(mWriter.joinable())
+        {
+            mWriter.join();
+        }
+    }
+
+private:
+    Logger() : mCells{std::make_unique<Cell[]>(mRingCapacity)}
+    {
+        for(std::size_t i = 0; i < mRingCapacity; ++i)
+        {
+            mCells[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+        mWriter = std::thread([this](){ Drain(); });
+    }
+
+    static char* Append(char* aOut, char* aEnd, std::string_view aText)
+    {
+        const std::size_t lLength = std::min<std::size_t>(aText.size(), aEnd - aOut);
+        std::memcpy(aOut, aText.data(), lLength);
+        return aOut + lLength;
+    }
+
+    static char* Append(char* aOut, char* aEnd, const char* aText)
+    {
+        return Append(aOut, aEnd, std::string_view(aText));
+    }
+
+    static char* Append(char* aOut, char* aEnd, char aChar)
+    {
+        return Append(aOut, aEnd, std::string_view(&aChar, 1));
+    }
+
+    template<typename T>
+        requires (std::integral<T> || std::floating_point<T>) && (!std::same_as<T, char>)
+    static char* Append(char* aOut, char* aEnd, T aValue)
+    {
+        if constexpr(std::same_as<T, bool>)
+        {
+            return Append(aOut, aEnd, aValue ? std::string_view("true") : std::string_view("false"));
+        }
+        else
+        {
+            auto [lPtr, lError] = std::to_chars(aOut, aEnd, aValue);
+            return lError == std::errc{} ? lPtr : aOut;
+        }
+    }
+
+    template<typename T>
+        requires std::convertible_to<const T&, std::string_view> && (!std::same_as<T, std::string_view>)
+    static char* Append(char* aOut, char* aEnd, const T& aText)
+    {
+        return Append(aOut, aEnd, std::string_view(aText));
+    }
+
+    static char* Append(char* aOut, char* aEnd, std::thread::id aThreadId)
+    {
+        return Append(aOut, aEnd, std::hash<std::thread::id>{}(aThreadId));
+    }
+
+    void Drain()
+    {
+        for(;;)
+        {
+            const uint32_t lWakeups = mWakeups.load();
+            const bool lRunning = mRunning.load();
+            if(DrainAvailable() > 0)
+            {
+                continue;
+            }
+            if(lRunning == false)
+            {
+                return;
+            }
+
+            mSleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(Pending() == false)
+            {
+                mWakeups.wait(lWakeups);
+            }
+            mSleeping.store(false);
+        }
+    }
+
+    bool Pending() const
+    {
+        const Cell& lCell = mCells[mTail % mRingCapacity];
+        return lCell.mSequence.load(std::memory_order_acquire) == mTail + 1;
+    }
+
+    std::size_t DrainAvailable()
+    {
+        std::size_t lDrained {0};
+        while(Pending())
+        {
+            Cell& lCell = mCells[mTail % mRingCapacity];
+            Print(lCell.mRecord);
+            lCell.mSequence.store(mTail + mRingCapacity, std::memory_order_release);
+            ++mTail;
+            ++lDrained;
+        }
+
+        if(lDrained > 0)
+        {
+            std::fflush(stdout);
+            std::fflush(stderr);
+        }
+        return lDrained;
+    }
+
+    static void Print(const LogRecord& aRecord)
+    {
+        const std::time_t lSeconds = std::chrono::system_clock::to_time_t(aRecord.mTime);
+        const auto lMillis = std::chrono::duration_cast<std::chrono::milliseconds>(aRecord.mTime.time_since_epoch()).count() % 1000;
+        std::tm lTime {};
+        localtime_r(&lSeconds, &lTime);
+
+        char lStamp[32];
+        std::strftime(lStamp, sizeof(lStamp), "%Y-%m-%d %H:%M:%S", &lTime);
+        std::FILE* lStream = aRecord.mLevel >= LogLevel::WARNING ? stderr : stdout;
+        const std::string_view lLevel = ToString(aRecord.mLevel);
+        std::fprintf(lStream, "[%s.%03d] [%.*s] %.*s\n", lStamp, static_cast<int>(lMillis), static_cast<int>(lLevel.size()), lLevel.data(),
+                     static_cast<int>(aRecord.mLength), aRecord.mText);
+    }
+
+    std::unique_ptr<Cell[]> mCells;
+    alignas(64) std::atomic<std::size_t> mHead {0};
+    alignas(64) std::size_t mTail {0};
+    std::atomic<uint32_t> mWakeups {0};
+    std::atomic<bool> mSleeping {false};
+    std::atomic<bool> mRunning {true};
+    std::atomic<LogLevel> mLevel {std::max(LogLevel::INFO, gCompileTimeLogLevel)};
+    std::atomic<uint64_t> mDropped {0};
+    std::thread mWriter;
+};
+
+// Arguments are concatenated, e.g. LOG_DEBUG("Key : ", lKey, " size ", lSize). Below the compile
+// time level the whole statement, argument evaluation included, is discarded.
+#define INMEMORYDB_LOG(level, ...)                                              \
+    do                                                                          \
+    {                                                                           \
+        if constexpr((level) >= gCompileTimeLogLevel)                           \
+        {                                                                       \
+            if(Logger::Instance().Enabled(level))                               \
+            {                                                                   \
+                Logger::Instance().Write(level, __VA_ARGS__);                   \
+            }                                                                   \
+        }                                                                       \
+    } while(0)
+
+#define LOG_DEBUG(...) INMEMORYDB_LOG(LogLevel::DEBUG, __VA_ARGS__)
+#define LOG_INFO(...) INMEMORYDB_LOG(LogLevel::INFO, __VA_ARGS__)
+#define LOG_WARNING(...) INMEMORYDB_LOG(LogLevel::WARNING, __VA_ARGS__)
+#define LOG_ERROR(...) INMEMORYDB_LOG(LogLevel::ERROR, __VA_ARGS__)
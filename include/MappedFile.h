@@ -0,0 +1,114 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <system_error>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Writes all of aData to aFd, retrying partial writes. Returns false with errno set on failure.
+inline bool WriteAll(int aFd, std::string_view aData)
+{
+    while(aData.empty() == false)
+    {
+        const ssize_t lWritten = ::write(aFd, aData.data(), aData.size());
+        if(lWritten < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        aData.remove_prefix(static_cast<std::size_t>(lWritten));
+    }
+    return true;
+}
+
+// Makes a rename or unlink of a file in the directory of aPath durable.
+inline bool SyncDirectory(const std::string& aPath)
+{
+    const std::filesystem::path lDirectory = std::filesystem::path(aPath).parent_path();
+    const int lFd = ::open(lDirectory.empty() ? "." : lDirectory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(lFd < 0)
+    {
+        return false;
+    }
+    const bool lSynced = ::fsync(lFd) == 0;
+    ::close(lFd);
+    return lSynced;
+}
+
+// Read-only memory mapping of a whole file, used to load persisted data without copying it
+// through read buffers. A missing file maps as empty; any other failure throws.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& aPath)
+    {
+        const int lFd = ::open(aPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if(lFd < 0)
+        {
+            if(errno == ENOENT)
+            {
+                return;
+            }
+            throw std::system_error(errno, std::generic_category(), "open " + aPath);
+        }
+
+        struct stat lStat {};
+        if(::fstat(lFd, &lStat) != 0)
+        {
+            const int lError = errno;
+            ::close(lFd);
+            throw std::system_error(lError, std::generic_category(), "stat " + aPath);
+        }
+
+        mExists = true;
+        mSize = static_cast<std::size_t>(lStat.st_size);
+        if(mSize > 0)
+        {
+            mData = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, lFd, 0);
+            if(mData == MAP_FAILED)
+            {
+                const int lError = errno;
+                ::close(lFd);
+                throw std::system_error(lError, std::generic_category(), "mmap " + aPath);
+            }
+            // Loading walks the file front to back, once.
+            ::madvise(mData, mSize, MADV_SEQUENTIAL);
+            ::madvise(mData, mSize, MADV_WILLNEED);
+        }
+        ::close(lFd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        if(mSize > 0)
+        {
+            ::munmap(mData, mSize);
+        }
+    }
+
+    bool Exists() const
+    {
+        return mExists;
+    }
+
+    std::string_view Data() const
+    {
+        return {static_cast<const char*>(mData), mSize};
+    }
+
+private:
+    void* mData {nullptr};
+    std::size_t mSize {0};
+    bool mExists {false};
+};
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <unistd.h>
+
+// Server metrics: request counts and latencies per op, connections, bytes in and out and reply
+// bytes waiting to be written. Every thread records into a block of its own, found through a
+// thread_local, so recording is a couple of plain stores to a cache line no other thread
+// writes: no lock, no locked instruction, no line bouncing between cores. A reader sums the
+// blocks of every thread that ever recorded, which is why blocks outlive their threads.
+
+// A counter only its own thread writes. The relaxed load and store compile to plain moves, yet
+// other threads reading it see whole values.
+class LocalCounter
+{
+public:
+    void Add(uint64_t aValue)
+    {
+        mValue.store(mValue.load(std::memory_order_relaxed) + aValue, std::memory_order_relaxed);
+    }
+
+    uint64_t Load() const
+    {
+        return mValue.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> mValue {0};
+};
+
+// Latency buckets in nanoseconds: everything up to 1024 ns, then each power of two up to 2^30
+// (about a second) split in four, and one bucket for everything slower. Coarser than Histogram,
+// at 82 buckets per op, and still good to a quarter of a power of two for percentiles. Every
+// fourth bound is a power of two, the buckets exported to Prometheus.
+struct LatencyBuckets
+{
+    static constexpr uint32_t mFirstShift {10};
+    static constexpr uint32_t mLastShift {30};
+    static constexpr std::size_t mSplit {4};
+    static constexpr std::size_t mNrOfBuckets {1 + (mLastShift - mFirstShift) * mSplit + 1};
+
+    static std::size_t IndexOf(uint64_t aNanos)
+    {
+        if(aNanos <= (uint64_t{1} << mFirstShift))
+        {
+            return 0;
+        }
+        if(aNanos > (uint64_t{1} << mLastShift))
+        {
+            return mNrOfBuckets - 1;
+        }
+        // 2^(lShift - 1) < aNanos <= 2^lShift; the two bits below the top one of aNanos - 1 pick
+        // the quarter.
+        const uint32_t lShift = static_cast<uint32_t>(std::bit_width(aNanos - 1));
+        const std::size_t lQuarter = static_cast<std::size_t>((aNanos - 1) >> (lShift - 3)) & (mSplit - 1);
+        return 1 + (lShift - mFirstShift - 1) * mSplit + lQuarter;
+    }
+
+    // Largest latency counted in the bucket; UINT64_MAX for the last one.
+    static uint64_t UpperBoundOf(std::size_t aIndex)
+    {
+        if(aIndex == 0)
+        {
+            return uint64_t{1} << mFirstShift;
+        }
+        if(aIndex == mNrOfBuckets - 1)
+        {
+            return UINT64_MAX;
+        }
+        const uint64_t lShift = mFirstShift + 1 + (aIndex - 1) / mSplit;
+        const uint64_t lQuarter = (aIndex - 1) % mSplit;
+        return (uint64_t{1} << (lShift - 1)) + ((lQuarter + 1) << (lShift - 3));
+    }
+};
+
+// What one thread recorded. Ops are the protocol's op numbers; larger ones are not recorded.
+struct alignas(64) ThreadMetrics
+{
+    static constexpr std::size_t mMaxOps {32};
+
+    struct Op
+    {
+        LocalCounter mNanos;
+        std::array<LocalCounter, LatencyBuckets::mNrOfBuckets> mBuckets;
+    };
+
+    std::array<Op, mMaxOps> mOps;
+    LocalCounter mBytesIn;
+    LocalCounter mBytesOut;
+    LocalCounter mConnectionsOpened;
+    LocalCounter mConnectionsClosed;
+    // Bytes added to and removed from the write queues by this thread. Queues may be added to
+    // on one thread and drained on another, so only the sum over all threads is meaningful; it
+    // is kept modulo 2^64, which makes that sum right.
+    LocalCounter mQueuedBytes;
+    LocalCounter mBackpressurePauses;
+};
+
+class Metrics
+{
+public:
+    struct OpTotals
+    {
+        uint64_t mCount {0};
+        uint64_t mNanos {0};
+        std::array<uint64_t, LatencyBuckets::mNrOfBuckets> mBuckets {};
+
+        // Upper bound of the bucket holding the aQuantile (0..1) latency, 0 without calls.
+        uint64_t Percentile(double aQuantile) const
+        {
+            if(mCount == 0)
+            {
+                return 0;
+            }
+            const uint64_t lRank = std::max<uint64_t>(1, static_cast<uint64_t>(aQuantile * static_cast<double>(mCount) + 0.5));
+            uint64_t lSeen {0};
+            for(std::size_t i = 0; i < mBuckets.size(); ++i)
+            {
+                lSeen += mBuckets[i];
+                if(lSeen >= lRank)
+                {
+                    return LatencyBuckets::UpperBoundOf(i);
+                }
+            }
+            return LatencyBuckets::UpperBoundOf(mBuckets.size() - 1);
+        }
+    };
+
+    struct Totals
+    {
+        std::array<OpTotals, ThreadMetrics::mMaxOps> mOps {};
+        uint64_t mBytesIn {0};
+        uint64_t mBytesOut {0};
+        uint64_t mConnectionsOpened {0};
+        uint64_t mConnectionsClosed {0};
+        uint64_t mQueuedBytes {0};
+        uint64_t mBackpressurePauses {0};
+    };
+
+    static Metrics& Instance()
+    {
+        static Metrics lInstance;
+        return lInstance;
+    }
+
+    // The calling thread's block, registered on its first use.
+    ThreadMetrics& Local()
+    {
+        thread_local ThreadMetrics& tLocal = Register();
+        return tLocal;
+    }
+
+    void RecordOp(std::size_t aOp, std::chrono::nanoseconds aLatency)
+    {
+        if(aOp >= ThreadMetrics::mMaxOps)
+        {
+            return;
+        }
+        const auto lNanos = static_cast<uint64_t>(std::max<int64_t>(aLatency.count(), 0));
+        ThreadMetrics::Op& lOp = Local().mOps[aOp];
+        lOp.mNanos.Add(lNanos);
+        lOp.mBuckets[LatencyBuckets::IndexOf(lNanos)].Add(1);
+    }
+
+    // Sums the blocks of every thread. Counters are read one by one while threads keep
+    // recording, so the totals are not a snapshot of one instant, but each is exact for some
+    // moment during the call.
+    Totals Collect() const
+    {
+        Totals lTotals;
+        std::lock_guard lLock{mMutex};
+        for(const std::unique_ptr<ThreadMetrics>& lThread : mThreads)
+        {
+            for(std::size_t i = 0; i < ThreadMetrics::mMaxOps; ++i)
+            {
+                OpTotals& lOp = lTotals.mOps[i];
+                lOp.mNanos += lThread->mOps[i].mNanos.Load();
+                for(std::size_t j = 0; j < LatencyBuckets::mNrOfBuckets; ++j)
+                {
+                    const uint64_t lCount = lThread->mOps[i].mBuckets[j].Load();
+                    lOp.mBuckets[j] += lCount;
+                    lOp.mCount += lCount;
+                }
+            }
+            lTotals.mBytesIn += lThread->mBytesIn.Load();
+            lTotals.mBytesOut += lThread->mBytesOut.Load();
+            lTotals.mConnectionsOpened += lThread->mConnectionsOpened.Load();
+            lTotals.mConnectionsClosed += lThread->mConnectionsClosed.Load();
+            lTotals.mQueuedBytes += lThread->mQueuedBytes.Load();
+            lTotals.mBackpressurePauses += lThread->mBackpressurePauses.Load();
+        }
+        return lTotals;
+    }
+
+private:
+    Metrics() = default;
+
+    ThreadMetrics& Register()
+    {
+        std::lock_guard lLock{mMutex};
+        mThreads.push_back(std::make_unique<ThreadMetrics>());
+        return *mThreads.back();
+    }
+
+    mutable std::mutex mMutex;
+    std::vector<std::unique_ptr<ThreadMetrics>> mThreads;
+};
+
+// Resident set size of the process, everything included (index, slabs, buffers, protobuf),
+// from /proc/self/statm; 0 where that is not available.
+inline std::size_t ResidentMemory()
+{
+    std::ifstream lStatm {"/proc/self/statm"};
+    std::size_t lPages {0};
+    std::size_t lResident {0};
+    if(!(lStatm >> lPages >> lResident))
+    {
+        return 0;
+    }
+    return lResident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
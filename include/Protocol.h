@@ -0,0 +1,320 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <optional>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include "Value.h"
+
+// Framing shared by the server and the client. Every message, in both directions, is preceded
+// by its length. A connection carries any number of frames and replies come back in the order
+// the requests were sent.
+//
+// Two header formats are understood:
+//  - ASCII_V1 : the length as 8 zero padded ASCII digits (at most 99,999,999 bytes).
+//  - BINARY_V2: the length as a 4 byte little-endian integer.
+// A client selects BINARY_V2 by sending gProtocolPreamble as the very first bytes on the
+// connection; the server echoes it back to acknowledge. Connections starting with anything
+// else are served with ASCII_V1, so old clients keep working unchanged.
+
+enum class ProtocolVersion : uint8_t
+{
+    ASCII_V1 = 1,
+    BINARY_V2 = 2
+};
+
+inline constexpr std::size_t gMsgHeaderLength {8};
+inline constexpr std::size_t gBinaryHeaderLength {4};
+inline constexpr char gProtocolPreamble[] {'I', 'M', 'D', static_cast<char>(ProtocolVersion::BINARY_V2)};
+inline constexpr std::size_t gProtocolPreambleLength {sizeof(gProtocolPreamble)};
+
+// Upper bound for a single frame, protects the server from allocating for a bogus header.
+inline constexpr uint32_t gMaxMsgLength {512u << 20};
+
+constexpr std::size_t HeaderLength(ProtocolVersion aVersion)
+{
+    return aVersion == ProtocolVersion::BINARY_V2 ? gBinaryHeaderLength : gMsgHeaderLength;
+}
+
+// Longest frame the header of aVersion can announce. Requests are bounded by gMaxMsgLength
+// anyway, but a reply (a large value read by an ASCII_V1 client, a big MGET) may not fit and
+// has to be refused rather than sent with a wrong length.
+constexpr std::size_t MaxFrameLength(ProtocolVersion aVersion)
+{
+    return aVersion == ProtocolVersion::BINARY_V2 ? std::size_t{UINT32_MAX} : std::size_t{99'999'999};
+}
+
+inline bool IsProtocolPreamble(const char* aData)
+{
+    return std::memcmp(aData, gProtocolPreamble, gProtocolPreambleLength) == 0;
+}
+
+// aHeader must point to HeaderLength(aVersion) bytes. Returns nullopt for a malformed header.
+inline std::optional<uint32_t> DecodeLength(ProtocolVersion aVersion, const char* aHeader)
+{
+    if(aVersion == ProtocolVersion::BINARY_V2)
+    {
+        const auto* lBytes = reinterpret_cast<const unsigned char*>(aHeader);
+        return static_cast<uint32_t>(lBytes[0]) | static_cast<uint32_t>(lBytes[1]) << 8 |
+               static_cast<uint32_t>(lBytes[2]) << 16 | static_cast<uint32_t>(lBytes[3]) << 24;
+    }
+
+    uint32_t lLength {0};
+    const char* lEnd = aHeader + gMsgHeaderLength;
+    auto [lPtr, lError] = std::from_chars(aHeader, lEnd, lLength);
+    if(lError != std::errc{} || lPtr != lEnd)
+    {
+        return std::nullopt;
+    }
+    return lLength;
+}
+
+// Writes the header for a frame of aLength bytes; aHeader must have room for HeaderLength(aVersion)
+// and aLength must not be above MaxFrameLength(aVersion).
+inline void EncodeLength(ProtocolVersion aVersion, uint32_t aLength, char* aHeader)
+{
+    if(aVersion == ProtocolVersion::BINARY_V2)
+    {
+        for(std::size_t idx = 0; idx < gBinaryHeaderLength; ++idx)
+        {
+            aHeader[idx] = static_cast<char>((aLength >> (8 * idx)) & 0xFF);
+        }
+        return;
+    }
+
+    for(std::size_t idx = gMsgHeaderLength; idx > 0; --idx)
+    {
+        aHeader[idx - 1] = static_cast<char>('0' + aLength % 10);
+        aLength /= 10;
+    }
+}
+
+inline std::string EncodeFrame(std::string_view aData, ProtocolVersion aVersion = ProtocolVersion::ASCII_V1)
+{
+    std::string lResult(HeaderLength(aVersion), '\0');
+    EncodeLength(aVersion, static_cast<uint32_t>(aData.size()), lResult.data());
+    lResult.append(aData);
+    return lResult;
+}
+
+// Protocol buffer base-128 varint; aOut needs room for gMaxVarintLength bytes.
+inline constexpr std::size_t gMaxVarintLength {10};
+
+inline std::size_t EncodeVarint(uint64_t aValue, char* aOut)
+{
+    std::size_t lLength {0};
+    while(aValue >= 0x80)
+    {
+        aOut[lLength++] = static_cast<char>((aValue & 0x7F) | 0x80);
+        aValue >>= 7;
+    }
+    aOut[lLength++] = static_cast<char>(aValue);
+    return lLength;
+}
+
+inline constexpr std::size_t VarintLength(uint64_t aValue)
+{
+    std::size_t lLength {1};
+    while(aValue >= 0x80)
+    {
+        aValue >>= 7;
+        ++lLength;
+    }
+    return lLength;
+}
+
+enum class FrameStatus
+{
+    COMPLETE,
+    INCOMPLETE,
+    INVALID
+};
+
+// Growable receive buffer for one connection. Bytes are read into the free tail and whole
+// frames are parsed straight out of it, so one read may yield several pipelined frames and a
+// frame split over several reads is simply completed by the next one. The storage keeps its
+// capacity between requests; only an exceptionally large frame makes it shrink back once idle.
+// A large frame is read in steps of at most mMaxReadStep, the storage doubling as it fills, so
+// memory follows the bytes that arrived and not the length a header announces.
+class FrameBuffer
+{
+public:
+    static constexpr std::size_t mMinReadSize {16 * 1024};
+    static constexpr std::size_t mMaxReadStep {1024 * 1024};
+    static constexpr std::size_t mMaxIdleCapacity {1024 * 1024};
+
+    // Makes room for at least aMinFree bytes after the readable data and returns the free tail.
+    char* Prepare(std::size_t aMinFree)
+    {
+        if(mEnd == mBegin)
+        {
+            mBegin = mEnd = 0;
+            if(mStorage.size() > mMaxIdleCapacity && aMinFree <= mMaxIdleCapacity)
+            {
+                std::vector<char>().swap(mStorage);
+            }
+        }
+
+        if(mStorage.size() - mEnd < aMinFree)
+        {
+            // Compact first, grow only if the frame really does not fit.
+            std::memmove(mStorage.data(), mStorage.data() + mBegin, mEnd - mBegin);
+            mEnd -= mBegin;
+            mBegin = 0;
+            if(mStorage.size() - mEnd < aMinFree)
+            {
+                mStorage.resize(std::max(mEnd + aMinFree, mStorage.size() * 2));
+            }
+        }
+        return mStorage.data() + mEnd;
+    }
+
+    std::size_t FreeSpace() const
+    {
+        return mStorage.size() - mEnd;
+    }
+
+    void Commit(std::size_t aBytes)
+    {
+        mEnd += aBytes;
+    }
+
+    std::string_view Readable() const
+    {
+        return {mStorage.data() + mBegin, mEnd - mBegin};
+    }
+
+    void Consume(std::size_t aBytes)
+    {
+        mBegin += aBytes;
+    }
+
+    // Extracts the next frame payload if it is complete. Otherwise aMissing is set to the number
+    // of bytes still needed before the frame can complete.
+    FrameStatus NextFrame(ProtocolVersion aVersion, std::string_view& aFrame, std::size_t& aMissing)
+    {
+        const std::string_view lReadable = Readable();
+        const std::size_t lHeaderLength = HeaderLength(aVersion);
+        if(lReadable.size() < lHeaderLength)
+        {
+            aMissing = lHeaderLength - lReadable.size();
+            return FrameStatus::INCOMPLETE;
+        }
+
+        std::optional<uint32_t> const lMsgLength = DecodeLength(aVersion, lReadable.data());
+        if(lMsgLength.has_value() == false || lMsgLength.value() > gMaxMsgLength)
+        {
+            return FrameStatus::INVALID;
+        }
+
+        const std::size_t lFrameLength = lHeaderLength + lMsgLength.value();
+        if(lReadable.size() < lFrameLength)
+        {
+            aMissing = lFrameLength - lReadable.size();
+            return FrameStatus::INCOMPLETE;
+        }
+
+        aFrame = lReadable.substr(lHeaderLength, lMsgLength.value());
+        Consume(lFrameLength);
+        return FrameStatus::COMPLETE;
+    }
+
+private:
+    std::vector<char> mStorage;
+    std::size_t mBegin {0};
+    std::size_t mEnd {0};
+};
+
+// Outgoing replies of one connection. Headers, status text and small values are copied into
+// one contiguous string; larger values are only referenced through the shared handle the store
+// handed out, so a GET reply never copies the value and the bytes stay alive until written.
+class ResponseBuffer
+{
+public:
+    static constexpr std::size_t mCopyThreshold {512};
+
+    void Append(std::string_view aBytes)
+    {
+        mBytes.append(aBytes);
+    }
+
+    void Append(ValueRef aValue)
+    {
+        if(aValue->Size() < mCopyThreshold)
+        {
+            mBytes.append(std::string_view(*aValue));
+            return;
+        }
+
+        CutSegment();
+        mReferencedBytes += aValue->Size();
+        mSegments.push_back({0, aValue->Size(), std::move(aValue)});
+    }
+
+    // Appends aLength bytes for the caller to fill in (a frame header, a serialized envelope)
+    // and returns where they start.
+    char* AppendSpace(std::size_t aLength)
+    {
+        mBytes.resize(mBytes.size() + aLength);
+        return mBytes.data() + mBytes.size() - aLength;
+    }
+
+    // Calls aVisitor(const char*, std::size_t) for every piece, in order.
+    template<typename Visitor>
+    void ForEachSegment(Visitor&& aVisitor)
+    {
+        CutSegment();
+        for(const auto& lSegment : mSegments)
+        {
+            const char* lData = lSegment.mValue ? lSegment.mValue->Data() : mBytes.data() + lSegment.mOffset;
+            aVisitor(lData, lSegment.mLength);
+        }
+    }
+
+    bool Empty() const
+    {
+        return mBytes.empty() && mSegments.empty();
+    }
+
+    // Bytes queued, copied or referenced.
+    std::size_t Size() const
+    {
+        return mBytes.size() + mReferencedBytes;
+    }
+
+    void Clear()
+    {
+        mBytes.clear();
+        mSegments.clear();
+        mCut = 0;
+        mReferencedBytes = 0;
+    }
+
+private:
+    struct Segment
+    {
+        std::size_t mOffset;
+        std::size_t mLength;
+        ValueRef mValue;
+    };
+
+    // Turns the bytes copied since the last cut into a segment of their own.
+    void CutSegment()
+    {
+        if(mBytes.size() > mCut)
+        {
+            mSegments.push_back({mCut, mBytes.size() - mCut, nullptr});
+            mCut = mBytes.size();
+        }
+    }
+
+    std::string mBytes;
+    std::vector<Segment> mSegments;
+    std::size_t mCut {0};
+    std::size_t mReferencedBytes {0};
+};
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+#include <sys/mman.h>
+
+// Size class slab allocator for the values of one shard.
+//
+// Chunks are carved from 64 KiB pages mapped straight from the kernel, each page serving one
+// size class, so a value costs no malloc call and no per allocation header, and a page that
+// empties is unmapped, giving its memory back instead of leaving a hole in the heap.
+//
+// Deletes leave pages partly used. BeginCompaction marks the sparsest pages of fragmented
+// classes as evacuating: they get no new chunks, the store copies their live values elsewhere
+// (see InMemoryDB::CompactTick), and once the last reference to a value on them is gone they
+// are unmapped.
+//
+// Allocate and Free take the arena's own lock, not the shard lock: values are created before
+// the shard is locked and released wherever their last reference is dropped.
+class SlabArena
+{
+public:
+    static constexpr std::size_t mPageSize {64 * 1024};
+    // Classes grow by about a quarter, bounding the rounding loss of a chunk to ~20%.
+    static constexpr std::array<uint32_t, 26> mClassSizes {
+        16, 24, 32, 48, 64, 80, 96, 128, 160, 192, 256, 320, 384,
+        512, 640, 768, 1024, 1280, 1536, 2048, 2560, 3072, 4096, 5120, 6144, 8192
+    };
+    static constexpr std::size_t mMaxChunkSize {mClassSizes.back()};
+
+    SlabArena() = default;
+    SlabArena(const SlabArena&) = delete;
+    SlabArena& operator=(const SlabArena&) = delete;
+
+    ~SlabArena()
+    {
+        for(std::vector<Page*>& lPages : mPages)
+        {
+            for(Page* lPage : lPages)
+            {
+                ::munmap(lPage, mPageSize);
+            }
+        }
+    }
+
+    // aSize must not exceed mMaxChunkSize. Throws std::bad_alloc when no page can be mapped.
+    void* Allocate(std::size_t aSize)
+    {
+        const uint32_t lClass = ClassOf(aSize);
+        std::lock_guard lLock{mMutex};
+        Page* lPage = mPartial[lClass];
+        if(lPage == nullptr)
+        {
+            lPage = NewPage(lClass);
+        }
+
+        void* lChunk;
+        if(lPage->mFree != nullptr)
+        {
+            lChunk = lPage->mFree;
+            lPage->mFree = *static_cast<void**>(lChunk);
+        }
+        else
+        {
+            lChunk = reinterpret_cast<char*>(lPage) + sizeof(Page) + static_cast<std::size_t>(lPage->mBump++) * mClassSizes[lClass];
+        }
+
+        if(++lPage->mLive == lPage->mCapacity)
+        {
+            Unlink(lPage);
+        }
+        mUsed += mClassSizes[lClass];
+        return lChunk;
+    }
+
+    // Returns a chunk of any arena; callable from any thread.
+    static void Free(void* aChunk)
+    {
+        Page* lPage = PageOf(aChunk);
+        lPage->mArena->Release(lPage, aChunk);
+    }
+
+    // True when the chunk sits on a page being evacuated and should be copied elsewhere.
+    static bool IsEvacuating(const void* aChunk)
+    {
+        return PageOf(aChunk)->mEvacuating.load(std::memory_order_relaxed);
+    }
+
+    // Marks for evacuation the pages of every class using less than half its page capacity
+    // whose own occupancy is below half. Returns the number of pages marked.
+    std::size_t BeginCompaction()
+    {
+        std::lock_guard lLock{mMutex};
+        std::size_t lMarked {0};
+        for(uint32_t lClass = 0; lClass < mClassSizes.size(); ++lClass)
+        {
+            std::vector<Page*>& lPages = mPages[lClass];
+            std::size_t lLive {0};
+            std::size_t lCapacity {0};
+            for(const Page* lPage : lPages)
+            {
+                lLive += lPage->mLive;
+                lCapacity += lPage->mCapacity;
+            }
+            if(lPages.size() < 2 || lLive * 2 >= lCapacity)
+            {
+                continue;
+            }
+
+            for(Page* lPage : lPages)
+            {
+                if(lPage->mEvacuating == false && lPage->mLive * 2 < lPage->mCapacity)
+                {
+                    Unlink(lPage);
+                    lPage->mEvacuating = true;
+                    ++mEvacuating;
+                    ++lMarked;
+                }
+            }
+        }
+        return lMarked;
+    }
+
+    // Pages still waiting for their live chunks to be moved or released.
+    std::size_t EvacuatingPages() const
+    {
+        std::lock_guard lLock{mMutex};
+        return mEvacuating;
+    }
+
+    // Bytes of the chunks in use, including their rounding to the size class.
+    std::size_t UsedBytes() const
+    {
+        std::lock_guard lLock{mMutex};
+        return mUsed;
+    }
+
+    // Bytes of the pages mapped.
+    std::size_t AllocatedBytes() const
+    {
+        std::lock_guard lLock{mMutex};
+        return mNrOfPages * mPageSize;
+    }
+
+private:
+    // Header at the start of every page; pages are aligned to their size so a chunk finds its
+    // page by masking its address.
+    struct alignas(64) Page
+    {
+        SlabArena* mArena;
+        void* mFree;
+        // Links of the class's list of pages with free chunks.
+        Page* mPrev;
+        Page* mNext;
+        uint32_t mIndex;
+        uint16_t mClass;
+        uint16_t mCapacity;
+        uint16_t mLive;
+        uint16_t mBump;
+        bool mLinked;
+        // Only set under the arena lock; read without it by IsEvacuating.
+        std::atomic<bool> mEvacuating;
+    };
+
+    static uint32_t ClassOf(std::size_t aSize)
+    {
+        uint32_t lClass {0};
+        while(mClassSizes[lClass] < aSize)
+        {
+            ++lClass;
+        }
+        return lClass;
+    }
+
+    static Page* PageOf(const void* aChunk)
+    {
+        return reinterpret_cast<Page*>(reinterpret_cast<uintptr_t>(aChunk) & ~(mPageSize - 1));
+    }
+
+    Page* NewPage(uint32_t aClass)
+    {
+        // Map twice the size and trim, to get a page aligned to its size.
+        void* lMapping = ::mmap(nullptr, 2 * mPageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(lMapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        const uintptr_t lStart = reinterpret_cast<uintptr_t>(lMapping);
+        const uintptr_t lAligned = (lStart + mPageSize - 1) & ~(mPageSize - 1);
+        if(lAligned > lStart)
+        {
+            ::munmap(lMapping, lAligned - lStart);
+        }
+        if(lAligned + mPageSize < lStart + 2 * mPageSize)
+        {
+            ::munmap(reinterpret_cast<void*>(lAligned + mPageSize), lStart + 2 * mPageSize - lAligned - mPageSize);
+        }
+
+        Page* lPage = new(reinterpret_cast<void*>(lAligned)) Page{};
+        lPage->mArena = this;
+        lPage->mClass = static_cast<uint16_t>(aClass);
+        lPage->mCapacity = static_cast<uint16_t>((mPageSize - sizeof(Page)) / mClassSizes[aClass]);
+        lPage->mIndex = static_cast<uint32_t>(mPages[aClass].size());
+        mPages[aClass].push_back(lPage);
+        ++mNrOfPages;
+        Link(lPage);
+        return lPage;
+    }
+
+    void Release(Page* aPage, void* aChunk)
+    {
+        std::lock_guard lLock{mMutex};
+        *static_cast<void**>(aChunk) = aPage->mFree;
+        aPage->mFree = aChunk;
+        --aPage->mLive;
+        mUsed -= mClassSizes[aPage->mClass];
+
+        // An empty page is given back, unless it is the last of a class still in use.
+        if(aPage->mLive == 0 && (aPage->mEvacuating || mPages[aPage->mClass].size() > 1))
+        {
+            DropPage(aPage);
+        }
+        else if(aPage->mLinked == false && aPage->mEvacuating == false)
+        {
+            Link(aPage);
+        }
+    }
+
+    void DropPage(Page* aPage)
+    {
+        std::vector<Page*>& lPages = mPages[aPage->mClass];
+        lPages.back()->mIndex = aPage->mIndex;
+        lPages[aPage->mIndex] = lPages.back();
+        lPages.pop_back();
+        if(aPage->mEvacuating)
+        {
+            --mEvacuating;
+        }
+        Unlink(aPage);
+        --mNrOfPages;
+        ::munmap(aPage, mPageSize);
+    }
+
+    void Link(Page* aPage)
+    {
+        Page*& lHead = mPartial[aPage->mClass];
+        aPage->mPrev = nullptr;
+        aPage->mNext = lHead;
+        if(lHead != nullptr)
+        {
+            lHead->mPrev = aPage;
+        }
+        lHead = aPage;
+        aPage->mLinked = true;
+    }
+
+    void Unlink(Page* aPage)
+    {
+        if(aPage->mLinked == false)
+        {
+            return;
+        }
+        (aPage->mPrev != nullptr ? aPage->mPrev->mNext : mPartial[aPage->mClass]) = aPage->mNext;
+        if(aPage->mNext != nullptr)
+        {
+            aPage->mNext->mPrev = aPage->mPrev;
+        }
+        aPage->mLinked = false;
+    }
+
+    mutable std::mutex mMutex;
+    std::array<Page*, mClassSizes.size()> mPartial {};
+    std::array<std::vector<Page*>, mClassSizes.size()> mPages;
+    std::size_t mNrOfPages {0};
+    std::size_t mEvacuating {0};
+    std::size_t mUsed {0};
+};
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <span>
+#include <optional>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include "InMemoryDB.h"
+#include "AppendLog.h"
+#include "LogRecord.h"
+#include "MappedFile.h"
+#include "Logger.h"
+
+// Point-in-time snapshots of the store, for fast restarts and to bound the append-only log.
+//
+// File layout (integers little-endian):
+//   "IMDSNAP1"
+//   one section per shard: u32 entry count | u64 body length | u32 CRC-32C of the body | body
+//     body = entries of u32 key length | u32 value length | u64 expire at | key | value
+//     the top bit of the value length is set for a value stored LZ4 compressed, the next one
+//     for an integer kept natively (8 bytes)
+//   trailer: u64 section offsets[n] | u32 n | u32 CRC-32C of offsets and n | "IMDSNAP1"
+// Entries have fixed size headers, so loading is a bounds check and two copies per entry, and
+// the trailer lets every loader thread start on its own section of the mapped file.
+//
+// A snapshot is consistent per shard: each shard is copied under its shared lock, one after the
+// other, while writes to the other shards continue. With an AppendLog the log is rotated first,
+// so the rotated part is covered by the snapshot and removed once the snapshot is durable; the
+// records still in the log may already be in the snapshot, and replaying them again yields the
+// same state.
+class Snapshotter
+{
+    static constexpr char mMagic[8] {'I', 'M', 'D', 'S', 'N', 'A', 'P', '1'};
+    static constexpr std::size_t mSectionHeaderLength {16};
+    static constexpr std::size_t mEntryHeaderLength {16};
+    static constexpr std::size_t mTrailerLength {16};
+    static constexpr uint32_t mCompressedFlag {1u << 31};
+    static constexpr uint32_t mIntegerFlag {1u << 30};
+
+public:
+    // A zero aInterval only snapshots on Request.
+    Snapshotter(const InMemoryDB& aStore, std::string aPath, AppendLog* aLog, std::chrono::seconds aInterval)
+        : mStore{aStore}, mPath{std::move(aPath)}, mLog{aLog}, mInterval{aInterval}
+    {
+        mThread = std::thread([this](){ Run(); });
+    }
+
+    Snapshotter(const Snapshotter&) = delete;
+    Snapshotter& operator=(const Snapshotter&) = delete;
+
+    ~Snapshotter()
+    {
+        {
+            std::lock_guard lLock{mMutex};
+            mRunning = false;
+        }
+        mCondition.notify_one();
+        mThread.join();
+    }
+
+    // Asks for a snapshot in the background. Returns false when one is already pending or being
+    // written.
+    bool Request()
+    {
+        {
+            std::lock_guard lLock{mMutex};
+            if(mRequested || mBusy)
+            {
+                return false;
+            }
+            mRequested = true;
+        }
+        mCondition.notify_one();
+        return true;
+    }
+
+    uint64_t Completed() const
+    {
+        return mCompleted.load(std::memory_order_relaxed);
+    }
+
+    // Loads aPath on aNrOfThreads threads, handing every entry to aApply(const LogRecord&) as a
+    // SET; entries of one key only occur once. Returns the number of entries, 0 when the file
+    // does not exist. Throws when the file is damaged.
+    template<typename Apply>
+    static std::size_t Load(const std::string& aPath, std::size_t aNrOfThreads, Apply&& aApply)
+    {
+        MappedFile lFile(aPath);
+        const std::string_view lData = lFile.Data();
+        if(lFile.Exists() == false)
+        {
+            return 0;
+        }
+
+        const std::string_view lMagic {mMagic, sizeof(mMagic)};
+        if(lData.size() < sizeof(mMagic) + mTrailerLength || lData.substr(0, sizeof(mMagic)) != lMagic ||
+           lData.substr(lData.size() - sizeof(mMagic)) != lMagic)
+        {
+            throw std::runtime_error(aPath + " is not a complete snapshot");
+        }
+
+        const char* lTrailer = lData.data() + lData.size() - mTrailerLength;
+        const std::size_t lNrOfSections = GetFixed<uint32_t>(lTrailer);
+        if(lNrOfSections * 8 > lData.size() - sizeof(mMagic) - mTrailerLength)
+        {
+            throw std::runtime_error(aPath + " has a damaged trailer");
+        }
+        const char* lOffsets = lTrailer - lNrOfSections * 8;
+        if(Crc32c(lOffsets, lNrOfSections * 8 + 4) != GetFixed<uint32_t>(lTrailer + 4))
+        {
+            throw std::runtime_error(aPath + " has a damaged trailer");
+        }
+        const std::size_t lSectionsEnd = static_cast<std::size_t>(lOffsets - lData.data());
+
+        std::atomic<std::size_t> lNextSection {0};
+        std::atomic<std::size_t> lLoaded {0};
+        std::atomic<bool> lDamaged {false};
+        auto lLoader = [&](){
+            for(std::size_t i = lNextSection.fetch_add(1); i < lNrOfSections && lDamaged.load() == false; i = lNextSection.fetch_add(1))
+            {
+                const std::size_t lOffset = GetFixed<uint64_t>(lOffsets + i * 8);
+                std::optional<std::size_t> lCount;
+                if(lOffset >= sizeof(mMagic) && lOffset <= lSectionsEnd && lSectionsEnd - lOffset >= mSectionHeaderLength)
+                {
+                    lCount = LoadSection(lData.substr(lOffset, lSectionsEnd - lOffset), aApply);
+                }
+                if(lCount.has_value() == false)
+                {
+                    lDamaged.store(true);
+                    return;
+                }
+                lLoaded.fetch_add(*lCount);
+            }
+        };
+
+        const std::size_t lNrOfThreads = std::clamp<std::size_t>(aNrOfThreads, 1, std::max<std::size_t>(1, lNrOfSections));
+        std::vector<std::thread> lThreads;
+        for(std::size_t i = 1; i < lNrOfThreads; ++i)
+        {
+            lThreads.emplace_back(lLoader);
+        }
+        lLoader();
+        for(std::thread& lThread : lThreads)
+        {
+            lThread.join();
+        }
+
+        if(lDamaged.load())
+        {
+            throw std::runtime_error(aPath + " has a damaged section");
+        }
+        LOG_INFO("Loaded ", lLoaded.load(), " keys from ", aPath, " on ", lNrOfThreads, " threads");
+        return lLoaded.load();
+    }
+
+private:
+    // Returns the number of entries of the section at the start of aData, nullopt when damaged.
+    template<typename Apply>
+    static std::optional<std::size_t> LoadSection(std::string_view aData, Apply& aApply)
+    {
+        const std::size_t lCount = GetFixed<uint32_t>(aData.data());
+        const uint64_t lLength = GetFixed<uint64_t>(aData.data() + 4);
+        if(lLength > aData.size() - mSectionHeaderLength)
+        {
+            return std::nullopt;
+        }
+        std::string_view lBody = aData.substr(mSectionHeaderLength, lLength);
+        if(Crc32c(lBody.data(), lBody.size()) != GetFixed<uint32_t>(aData.data() + 12))
+        {
+            return std::nullopt;
+        }
+
+        for(std::size_t i = 0; i < lCount; ++i)
+        {
+            if(lBody.size() < mEntryHeaderLength)
+            {
+                return std::nullopt;
+            }
+            const std::size_t lKeyLength = GetFixed<uint32_t>(lBody.data());
+            const uint32_t lValueField = GetFixed<uint32_t>(lBody.data() + 4);
+            const std::size_t lValueLength = lValueField & ~(mCompressedFlag | mIntegerFlag);
+            LogOp lOp {LogOp::SET};
+            if((lValueField & mCompressedFlag) != 0)
+            {
+                lOp = LogOp::SET_LZ4;
+            }
+            else if((lValueField & mIntegerFlag) != 0)
+            {
+                lOp = LogOp::SET_INT64;
+            }
+            const uint64_t lExpireAt = GetFixed<uint64_t>(lBody.data() + 8);
+            lBody.remove_prefix(mEntryHeaderLength);
+            if(lBody.size() < lKeyLength + lValueLength)
+            {
+                return std::nullopt;
+            }
+            aApply(LogRecord{lOp, lBody.substr(0, lKeyLength), lBody.substr(lKeyLength, lValueLength), lExpireAt});
+            lBody.remove_prefix(lKeyLength + lValueLength);
+        }
+        return lBody.empty() ? std::optional<std::size_t>{lCount} : std::nullopt;
+    }
+
+    void Run()
+    {
+        std::unique_lock lLock{mMutex};
+        for(;;)
+        {
+            const auto lWakeUp = [this](){ return mRequested || mRunning == false; };
+            if(mInterval.count() > 0)
+            {
+                mCondition.wait_for(lLock, mInterval, lWakeUp);
+            }
+            else
+            {
+                mCondition.wait(lLock, lWakeUp);
+            }
+            if(mRunning == false)
+            {
+                return;
+            }
+
+            mRequested = false;
+            mBusy = true;
+            lLock.unlock();
+            try
+            {
+                Write();
+                mCompleted.fetch_add(1, std::memory_order_relaxed);
+            }
+            catch(const std::exception& e)
+            {
+                LOG_ERROR("Error writing snapshot: ", e.what());
+            }
+            lLock.lock();
+            mBusy = false;
+        }
+    }
+
+    void Write()
+    {
+        const auto lStart = std::chrono::steady_clock::now();
+        std::vector<std::string> lCovered;
+        if(mLog != nullptr)
+        {
+            mLog->Rotate();
+            lCovered = AppendLog::RotatedFiles(mLog->Path());
+        }
+
+        const std::string lTemporary = mPath + ".tmp";
+        const int lFd = ::open(lTemporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if(lFd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "open " + lTemporary);
+        }
+
+        std::size_t lKeys {0};
+        std::vector<uint64_t> lOffsets;
+        uint64_t lPosition {sizeof(mMagic)};
+        std::string lSection;
+        bool lWritten = WriteAll(lFd, std::string_view(mMagic, sizeof(mMagic)));
+        mStore.ForEachShardCopy([&](std::span<const InMemoryDB::SnapshotEntry> aEntries){
+            lSection.assign(mSectionHeaderLength, '\0');
+            for(const InMemoryDB::SnapshotEntry& lEntry : aEntries)
+            {
+                lSection.resize(lSection.size() + mEntryHeaderLength);
+                char* const lHeader = lSection.data() + lSection.size() - mEntryHeaderLength;
+                PutFixed<uint32_t>(lHeader, static_cast<uint32_t>(lEntry.mKey.size()));
+                const Codec lCodec = lEntry.mValue->GetCodec();
+                const uint32_t lFlag = lCodec == Codec::LZ4 ? mCompressedFlag : lCodec == Codec::INT64 ? mIntegerFlag : 0;
+                PutFixed<uint32_t>(lHeader + 4, static_cast<uint32_t>(lEntry.mValue->Size()) | lFlag);
+                PutFixed<uint64_t>(lHeader + 8, lEntry.mExpireAt);
+                lSection += lEntry.mKey;
+                lSection += std::string_view(*lEntry.mValue);
+            }
+            const std::size_t lBodyLength = lSection.size() - mSectionHeaderLength;
+            PutFixed<uint32_t>(lSection.data(), static_cast<uint32_t>(aEntries.size()));
+            PutFixed<uint64_t>(lSection.data() + 4, lBodyLength);
+            PutFixed<uint32_t>(lSection.data() + 12, Crc32c(lSection.data() + mSectionHeaderLength, lBodyLength));
+
+            lWritten = lWritten && WriteAll(lFd, lSection);
+            lOffsets.push_back(lPosition);
+            lPosition += lSection.size();
+            lKeys += aEntries.size();
+        });
+
+        std::string lTrailer(lOffsets.size() * 8 + mTrailerLength, '\0');
+        for(std::size_t i = 0; i < lOffsets.size(); ++i)
+        {
+            PutFixed<uint64_t>(lTrailer.data() + i * 8, lOffsets[i]);
+        }
+        PutFixed<uint32_t>(lTrailer.data() + lOffsets.size() * 8, static_cast<uint32_t>(lOffsets.size()));
+        PutFixed<uint32_t>(lTrailer.data() + lOffsets.size() * 8 + 4, Crc32c(lTrailer.data(), lOffsets.size() * 8 + 4));
+        std::memcpy(lTrailer.data() + lTrailer.size() - sizeof(mMagic), mMagic, sizeof(mMagic));
+
+        lWritten = lWritten && WriteAll(lFd, lTrailer) && ::fdatasync(lFd) == 0;
+        const int lError = errno;
+        ::close(lFd);
+        if(lWritten == false || ::rename(lTemporary.c_str(), mPath.c_str()) != 0)
+        {
+            throw std::system_error(lWritten ? errno : lError, std::generic_category(), "write " + mPath);
+        }
+        SyncDirectory(mPath);
+
+        for(const std::string& lFile : lCovered)
+        {
+            std::remove(lFile.c_str());
+        }
+
+        const auto lElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - lStart);
+        LOG_INFO("Snapshot of ", lKeys, " keys written to ", mPath, " in ", lElapsed.count(), " ms");
+    }
+
+    const InMemoryDB& mStore;
+    const std::string mPath;
+    AppendLog* const mLog;
+    const std::chrono::seconds mInterval;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mRequested {false};
+    bool mBusy {false};
+    bool mRunning {true};
+    std::atomic<uint64_t> mCompleted {0};
+    std::thread mThread;
+};
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include "Logger.h"
+
+// Request tracing: the connection notes when a request's frame header and body were read, when
+// it was parsed, when the op completed and when its reply was written. Requests slower than a
+// threshold are kept in a bounded slow log; sampled ones are written to the log. Both are off
+// by default and can be switched at runtime; while off, a request costs a relaxed load more.
+
+struct RequestTrace
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point mHeaderRead {};
+    Clock::time_point mBodyRead {};
+    Clock::time_point mParsed {};
+    Clock::time_point mExecuted {};
+    Clock::time_point mWritten {};
+    uint64_t mId {0};
+    uint32_t mOp {0};
+    std::string_view mOpName {};
+    // The first mMaxKeyLength bytes of the key.
+    std::string mKey;
+    bool mSampled {false};
+
+    static constexpr std::size_t mMaxKeyLength {64};
+
+    // Stages, adding up to Total: reading the rest of the frame once its header was in,
+    // waiting behind the frames before it and parsing, running the op and queueing the reply,
+    // and writing it out.
+    std::chrono::nanoseconds Read() const { return mBodyRead - mHeaderRead; }
+    std::chrono::nanoseconds Parse() const { return mParsed - mBodyRead; }
+    std::chrono::nanoseconds Engine() const { return mExecuted - mParsed; }
+    std::chrono::nanoseconds Write() const { return mWritten - mExecuted; }
+    std::chrono::nanoseconds Total() const { return mWritten - mHeaderRead; }
+};
+
+struct SlowRequest
+{
+    uint64_t mSequence {0};
+    std::chrono::system_clock::time_point mLoggedAt {};
+    RequestTrace mTrace;
+};
+
+class Tracer
+{
+public:
+    static constexpr std::size_t mDefaultSlowLogLength {128};
+
+    static Tracer& Instance()
+    {
+        static Tracer lInstance;
+        return lInstance;
+    }
+
+    // Requests taking longer go to the slow log; 0 turns it off.
+    void SetSlowThreshold(std::chrono::microseconds aThreshold)
+    {
+        const auto lMicros = static_cast<uint64_t>(std::max<int64_t>(aThreshold.count(), 0));
+        mSlowThresholdNs.store(std::min(lMicros, UINT64_MAX / 1000) * 1000, std::memory_order_relaxed);
+    }
+
+    std::chrono::microseconds SlowThreshold() const
+    {
+        return std::chrono::microseconds{mSlowThresholdNs.load(std::memory_order_relaxed) / 1000};
+    }
+
+    // One request in every aEvery is traced to the log, per io thread; 0 turns it off.
+    void SetSampleEvery(uint32_t aEvery)
+    {
+        mSampleEvery.store(aEvery, std::memory_order_relaxed);
+    }
+
+    uint32_t SampleEvery() const
+    {
+        return mSampleEvery.load(std::memory_order_relaxed);
+    }
+
+    // Oldest entries are dropped once the slow log holds aLength.
+    void SetSlowLogLength(std::size_t aLength)
+    {
+        std::lock_guard lLock{mMutex};
+        mMaxSlowLog = aLength;
+        while(mSlowLog.size() > mMaxSlowLog)
+        {
+            mSlowLog.pop_back();
+        }
+    }
+
+    // Whether requests are to be traced at all.
+    bool Enabled() const
+    {
+        return mSlowThresholdNs.load(std::memory_order_relaxed) != 0 || mSampleEvery.load(std::memory_order_relaxed) != 0;
+    }
+
+    // Whether the calling thread's next traced request is a sampled one.
+    bool Sample()
+    {
+        const uint32_t lEvery = mSampleEvery.load(std::memory_order_relaxed);
+        thread_local uint32_t tCount {0};
+        if(lEvery == 0 || ++tCount < lEvery)
+        {
+            return false;
+        }
+        tCount = 0;
+        return true;
+    }
+
+    // Called once the reply of a traced request is written.
+    void Finish(RequestTrace&& aTrace)
+    {
+        if(aTrace.mSampled)
+        {
+            LOG_INFO("Trace ", aTrace.mOpName, " id ", aTrace.mId, " key '", aTrace.mKey, "': read ", aTrace.Read().count(),
+                     " ns, parse ", aTrace.Parse().count(), " ns, engine ", aTrace.Engine().count(), " ns, write ", aTrace.Write().count(),
+                     " ns, total ", aTrace.Total().count(), " ns");
+        }
+        const uint64_t lThreshold = mSlowThresholdNs.load(std::memory_order_relaxed);
+        if(lThreshold == 0 || static_cast<uint64_t>(aTrace.Total().count()) < lThreshold)
+        {
+            return;
+        }
+
+        std::lock_guard lLock{mMutex};
+        if(mMaxSlowLog == 0)
+        {
+            return;
+        }
+        if(mSlowLog.size() == mMaxSlowLog)
+        {
+            mSlowLog.pop_back();
+        }
+        mSlowLog.push_front({mNextSequence++, std::chrono::system_clock::now(), std::move(aTrace)});
+    }
+
+    // Up to aLimit slow log entries, newest first.
+    std::vector<SlowRequest> SlowRequests(std::size_t aLimit) const
+    {
+        std::lock_guard lLock{mMutex};
+        const std::size_t lCount = std::min(aLimit, mSlowLog.size());
+        return {mSlowLog.begin(), mSlowLog.begin() + static_cast<std::ptrdiff_t>(lCount)};
+    }
+
+    std::size_t SlowLogLength() const
+    {
+        std::lock_guard lLock{mMutex};
+        return mSlowLog.size();
+    }
+
+    void ResetSlowLog()
+    {
+        std::lock_guard lLock{mMutex};
+        mSlowLog.clear();
+    }
+
+private:
+    Tracer() = default;
+
+    std::atomic<uint64_t> mSlowThresholdNs {0};
+    std::atomic<uint32_t> mSampleEvery {0};
+    mutable std::mutex mMutex;
+    std::deque<SlowRequest> mSlowLog;
+    std::size_t mMaxSlowLog {mDefaultSlowLogLength};
+    uint64_t mNextSequence {0};
+};
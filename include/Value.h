@@ -0,0 +1,274 @@
+#pragma once
+
+#include <atomic>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include "Slab.h"
+#include "Compression.h"
+
+// Immutable value bytes shared between the store and everything still sending or logging them.
+// The reference count lives in an 8 byte header in front of the bytes, so a value is a single
+// slab chunk: no control block, no separate string buffer. Values too large for a slab class
+// keep their bytes in a std::string they were moved from, so large SETs are still not copied.
+// A value also records the codec of its bytes (see Compression.h); Size and Data are always
+// the bytes as stored, Decode gives them back as clients wrote them. Integers are the one
+// exception to immutability: UpdateInteger changes one nobody else references.
+class Value
+{
+public:
+    // Largest value stored inline in a slab chunk.
+    static constexpr std::size_t mMaxInlineSize {SlabArena::mMaxChunkSize - 8};
+    // Largest value at all, what the 30 bit size field holds; above the protocol's frame limit.
+    static constexpr std::size_t mMaxSize {(1u << 30) - 1};
+
+    const char* Data() const;
+
+    std::size_t Size() const
+    {
+        return mSize;
+    }
+
+    operator std::string_view() const
+    {
+        return {Data(), mSize};
+    }
+
+    Codec GetCodec() const
+    {
+        return static_cast<Codec>(mCodec);
+    }
+
+    // Length of the value once decoded.
+    std::size_t DecodedSize() const
+    {
+        if(GetCodec() == Codec::INT64)
+        {
+            char lDigits[mMaxIntegerDigits];
+            return static_cast<std::size_t>(std::to_chars(lDigits, lDigits + sizeof(lDigits), Integer()).ptr - lDigits);
+        }
+        return GetCodec() == Codec::LZ4 ? Lz4DecodedSize(*this) : mSize;
+    }
+
+    // Writes the DecodedSize() bytes of the value to aOut. False when compressed bytes are
+    // damaged.
+    bool Decode(char* aOut) const
+    {
+        if(GetCodec() == Codec::INT64)
+        {
+            std::to_chars(aOut, aOut + mMaxIntegerDigits, Integer());
+            return true;
+        }
+        if(GetCodec() == Codec::LZ4)
+        {
+            return DecompressLz4(*this, aOut);
+        }
+        std::memcpy(aOut, Data(), mSize);
+        return true;
+    }
+
+    // The number of an INT64 value.
+    int64_t Integer() const
+    {
+        uint64_t lBits {0};
+        for(std::size_t i = 0; i < sizeof(lBits); ++i)
+        {
+            lBits |= static_cast<uint64_t>(static_cast<unsigned char>(Data()[i])) << (8 * i);
+        }
+        return static_cast<int64_t>(lBits);
+    }
+
+    // Overwrites an INT64 value in place when the caller holds the only reference, so nobody
+    // can be reading it; the store calls it under the shard's exclusive lock, where no new
+    // reference can be taken. False, and nothing changed, otherwise.
+    bool UpdateInteger(int64_t aValue) const
+    {
+        if(GetCodec() != Codec::INT64 || mRefs.load(std::memory_order_acquire) != 1)
+        {
+            return false;
+        }
+        PutInteger(const_cast<char*>(Data()), aValue);
+        return true;
+    }
+
+    static constexpr std::size_t mMaxIntegerDigits {20};
+
+    // Copies aBytes, stored with aCodec, into aArena, or takes them over when too large for a
+    // slab class; aBytes is left untouched in the first case, so a caller can keep reusing its
+    // buffer. Throws std::length_error above mMaxSize.
+    static const Value* Create(SlabArena& aArena, std::string&& aBytes, Codec aCodec = Codec::NONE);
+    static const Value* Create(SlabArena& aArena, std::string_view aBytes, Codec aCodec = Codec::NONE);
+    static const Value* CreateInteger(SlabArena& aArena, int64_t aValue);
+
+    // True for an inline value whose chunk is being evacuated by compaction.
+    bool Evacuating() const
+    {
+        return mSize <= mMaxInlineSize && SlabArena::IsEvacuating(this);
+    }
+
+protected:
+    Value(std::size_t aSize, Codec aCodec) : mRefs{1}, mSize{static_cast<uint32_t>(aSize)}, mCodec{static_cast<uint32_t>(aCodec)} {}
+
+private:
+    friend class ValueRef;
+
+    static void PutInteger(char* aOut, int64_t aValue)
+    {
+        for(std::size_t i = 0; i < sizeof(aValue); ++i)
+        {
+            aOut[i] = static_cast<char>(static_cast<uint64_t>(aValue) >> (8 * i));
+        }
+    }
+
+    void Retain() const
+    {
+        mRefs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Release() const;
+
+    mutable std::atomic<uint32_t> mRefs;
+    const uint32_t mSize : 30;
+    const uint32_t mCodec : 2;
+};
+
+static_assert(sizeof(Value) == 8);
+
+class LargeValue : public Value
+{
+public:
+    LargeValue(std::string&& aBytes, Codec aCodec) : Value(aBytes.size(), aCodec), mBytes{std::move(aBytes)} {}
+
+    std::string mBytes;
+};
+
+inline const char* Value::Data() const
+{
+    if(mSize > mMaxInlineSize)
+    {
+        return static_cast<const LargeValue*>(this)->mBytes.data();
+    }
+    return reinterpret_cast<const char*>(this + 1);
+}
+
+inline const Value* Value::Create(SlabArena& aArena, std::string&& aBytes, Codec aCodec)
+{
+    if(aBytes.size() > mMaxInlineSize)
+    {
+        if(aBytes.size() > mMaxSize)
+        {
+            throw std::length_error("Value too large");
+        }
+        return new LargeValue(std::move(aBytes), aCodec);
+    }
+    return Create(aArena, std::string_view(aBytes), aCodec);
+}
+
+inline const Value* Value::Create(SlabArena& aArena, std::string_view aBytes, Codec aCodec)
+{
+    if(aBytes.size() > mMaxInlineSize)
+    {
+        return Create(aArena, std::string(aBytes), aCodec);
+    }
+    void* lChunk = aArena.Allocate(sizeof(Value) + aBytes.size());
+    Value* lValue = new(lChunk) Value(aBytes.size(), aCodec);
+    std::memcpy(reinterpret_cast<char*>(lValue + 1), aBytes.data(), aBytes.size());
+    return lValue;
+}
+
+inline const Value* Value::CreateInteger(SlabArena& aArena, int64_t aValue)
+{
+    char lBytes[sizeof(aValue)];
+    PutInteger(lBytes, aValue);
+    return Create(aArena, std::string_view(lBytes, sizeof(lBytes)), Codec::INT64);
+}
+
+inline void Value::Release() const
+{
+    if(mRefs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
+    if(mSize > mMaxInlineSize)
+    {
+        delete static_cast<const LargeValue*>(this);
+        return;
+    }
+    SlabArena::Free(const_cast<Value*>(this));
+}
+
+// Counted reference to a Value, used like a shared_ptr<const Value> but one pointer wide.
+class ValueRef
+{
+public:
+    ValueRef() = default;
+    ValueRef(std::nullptr_t) {}
+
+    // Adopts the reference Value::Create returned.
+    explicit ValueRef(const Value* aValue) : mValue{aValue} {}
+
+    ValueRef(const ValueRef& aOther) : mValue{aOther.mValue}
+    {
+        if(mValue != nullptr)
+        {
+            mValue->Retain();
+        }
+    }
+
+    ValueRef(ValueRef&& aOther) noexcept : mValue{aOther.mValue}
+    {
+        aOther.mValue = nullptr;
+    }
+
+    ValueRef& operator=(ValueRef aOther) noexcept
+    {
+        swap(aOther);
+        return *this;
+    }
+
+    ~ValueRef()
+    {
+        if(mValue != nullptr)
+        {
+            mValue->Release();
+        }
+    }
+
+    void swap(ValueRef& aOther) noexcept
+    {
+        std::swap(mValue, aOther.mValue);
+    }
+
+    const Value* get() const
+    {
+        return mValue;
+    }
+
+    const Value& operator*() const
+    {
+        return *mValue;
+    }
+
+    const Value* operator->() const
+    {
+        return mValue;
+    }
+
+    explicit operator bool() const
+    {
+        return mValue != nullptr;
+    }
+
+    friend bool operator==(const ValueRef& aValue, std::nullptr_t)
+    {
+        return aValue.mValue == nullptr;
+    }
+
+private:
+    const Value* mValue {nullptr};
+};
@@ -1,101 +1,212 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
 // source: format.proto
-// Protobuf C++ Version: 6.31.0-dev
 
-#ifndef format_2eproto_2epb_2eh
-#define format_2eproto_2epb_2eh
+#ifndef GOOGLE_PROTOBUF_INCLUDED_format_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_format_2eproto
 
 #include <limits>
 #include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/runtime_version.h"
-#if PROTOBUF_VERSION != 6031000
-#error "Protobuf C++ gencode is built with an incompatible version of"
-#error "Protobuf C++ headers/runtime. See"
-#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
-#endif
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/message_lite.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
 
-// Must be included last.
-#include "google/protobuf/port_def.inc"
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_format_2eproto
-
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 namespace internal {
-template <typename T>
-::absl::string_view GetAnyMessageName();
+class AnyMetadata;
 }  // namespace internal
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_format_2eproto {
-  static const ::uint32_t offsets[];
+  static const uint32_t offsets[];
 };
-extern "C" {
-extern const ::google::protobuf::internal::DescriptorTable descriptor_table_format_2eproto;
-}  // extern "C"
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_format_2eproto;
 namespace pkg {
+class KeyValue;
+struct KeyValueDefaultTypeInternal;
+extern KeyValueDefaultTypeInternal _KeyValue_default_instance_;
 class Payload;
 struct PayloadDefaultTypeInternal;
 extern PayloadDefaultTypeInternal _Payload_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull Payload_class_data_;
+class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+class Response;
+struct ResponseDefaultTypeInternal;
+extern ResponseDefaultTypeInternal _Response_default_instance_;
+class Response_StatsEntry_DoNotUse;
+struct Response_StatsEntry_DoNotUseDefaultTypeInternal;
+extern Response_StatsEntry_DoNotUseDefaultTypeInternal _Response_StatsEntry_DoNotUse_default_instance_;
+class Result;
+struct ResultDefaultTypeInternal;
+extern ResultDefaultTypeInternal _Result_default_instance_;
+class SlowRequest;
+struct SlowRequestDefaultTypeInternal;
+extern SlowRequestDefaultTypeInternal _SlowRequest_default_instance_;
 }  // namespace pkg
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-
+PROTOBUF_NAMESPACE_OPEN
+template<> ::pkg::KeyValue* Arena::CreateMaybeMessage<::pkg::KeyValue>(Arena*);
+template<> ::pkg::Payload* Arena::CreateMaybeMessage<::pkg::Payload>(Arena*);
+template<> ::pkg::Request* Arena::CreateMaybeMessage<::pkg::Request>(Arena*);
+template<> ::pkg::Response* Arena::CreateMaybeMessage<::pkg::Response>(Arena*);
+template<> ::pkg::Response_StatsEntry_DoNotUse* Arena::CreateMaybeMessage<::pkg::Response_StatsEntry_DoNotUse>(Arena*);
+template<> ::pkg::Result* Arena::CreateMaybeMessage<::pkg::Result>(Arena*);
+template<> ::pkg::SlowRequest* Arena::CreateMaybeMessage<::pkg::SlowRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace pkg {
 
-// ===================================================================
+enum Op : int {
+  OP_UNSPECIFIED = 0,
+  OP_GET = 1,
+  OP_SET = 2,
+  OP_DEL = 3,
+  OP_EXISTS = 4,
+  OP_PING = 5,
+  OP_MGET = 6,
+  OP_MSET = 7,
+  OP_MDEL = 8,
+  OP_EXPIRE = 9,
+  OP_TTL = 10,
+  OP_STATS = 11,
+  OP_SNAPSHOT = 12,
+  OP_RANGE_SCAN = 13,
+  OP_SCAN = 14,
+  OP_SLOWLOG = 15,
+  OP_TRACE = 16,
+  OP_INCRBY = 17,
+  OP_APPEND = 18,
+  OP_GETSET = 19,
+  OP_SETNX = 20,
+  OP_CAS = 21,
+  Op_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Op_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Op_IsValid(int value);
+constexpr Op Op_MIN = OP_UNSPECIFIED;
+constexpr Op Op_MAX = OP_CAS;
+constexpr int Op_ARRAYSIZE = Op_MAX + 1;
 
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Op_descriptor();
+template<typename T>
+inline const std::string& Op_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Op>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Op_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Op_descriptor(), enum_t_value);
+}
+inline bool Op_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Op* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Op>(
+    Op_descriptor(), name, value);
+}
+enum Codec : int {
+  CODEC_NONE = 0,
+  CODEC_LZ4 = 1,
+  Codec_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Codec_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Codec_IsValid(int value);
+constexpr Codec Codec_MIN = CODEC_NONE;
+constexpr Codec Codec_MAX = CODEC_LZ4;
+constexpr int Codec_ARRAYSIZE = Codec_MAX + 1;
 
-// -------------------------------------------------------------------
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Codec_descriptor();
+template<typename T>
+inline const std::string& Codec_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Codec>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Codec_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Codec_descriptor(), enum_t_value);
+}
+inline bool Codec_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Codec* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Codec>(
+    Codec_descriptor(), name, value);
+}
+enum Status : int {
+  STATUS_OK = 0,
+  STATUS_NOT_FOUND = 1,
+  STATUS_ERROR = 2,
+  STATUS_BAD_REQUEST = 3,
+  STATUS_UNSUPPORTED = 4,
+  STATUS_CONFLICT = 5,
+  Status_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Status_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Status_IsValid(int value);
+constexpr Status Status_MIN = STATUS_OK;
+constexpr Status Status_MAX = STATUS_CONFLICT;
+constexpr int Status_ARRAYSIZE = Status_MAX + 1;
 
-class Payload final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:pkg.Payload) */ {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Status_descriptor();
+template<typename T>
+inline const std::string& Status_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Status>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Status_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Status_descriptor(), enum_t_value);
+}
+inline bool Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Status* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Status>(
+    Status_descriptor(), name, value);
+}
+// ===================================================================
+
+class Payload final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pkg.Payload) */ {
  public:
   inline Payload() : Payload(nullptr) {}
-  ~Payload() PROTOBUF_FINAL;
+  ~Payload() override;
+  explicit PROTOBUF_CONSTEXPR Payload(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(Payload* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(Payload));
+  Payload(const Payload& from);
+  Payload(Payload&& from) noexcept
+    : Payload() {
+    *this = ::std::move(from);
   }
-#endif
 
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR Payload(::google::protobuf::internal::ConstantInitialized);
-
-  inline Payload(const Payload& from) : Payload(nullptr, from) {}
-  inline Payload(Payload&& from) noexcept
-      : Payload(nullptr, std::move(from)) {}
   inline Payload& operator=(const Payload& from) {
     CopyFrom(from);
     return *this;
   }
   inline Payload& operator=(Payload&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -103,351 +214,3315 @@ class Payload final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
   static const Payload& default_instance() {
-    return *reinterpret_cast<const Payload*>(
-        &_Payload_default_instance_);
+    return *internal_default_instance();
+  }
+  static inline const Payload* internal_default_instance() {
+    return reinterpret_cast<const Payload*>(
+               &_Payload_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Payload& a, Payload& b) {
+    a.Swap(&b);
   }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(Payload& a, Payload& b) { a.Swap(&b); }
-  inline void Swap(Payload* PROTOBUF_NONNULL other) {
+  inline void Swap(Payload* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Payload* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(Payload* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  Payload* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<Payload>(arena);
+  Payload* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Payload>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Payload& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const Payload& from) { Payload::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Payload& from) {
+    Payload::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(Payload* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "pkg.Payload"; }
-
- protected:
-  explicit Payload(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  Payload(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Payload& from);
-  Payload(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, Payload&& from) noexcept
-      : Payload(arena) {
-    *this = ::std::move(from);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Payload* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pkg.Payload";
   }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
+  protected:
+  explicit Payload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
- public:
-  static constexpr auto InternalGenerateClassData_();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
     kKeyFieldNumber = 1,
     kValueFieldNumber = 2,
   };
   // optional string key = 1;
   bool has_key() const;
-  void clear_key() ;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
   const std::string& key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_key(Arg_&& arg, Args_... args);
-  std::string* PROTOBUF_NONNULL mutable_key();
-  [[nodiscard]] std::string* PROTOBUF_NULLABLE release_key();
-  void set_allocated_key(std::string* PROTOBUF_NULLABLE value);
-
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
   private:
   const std::string& _internal_key() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
-  std::string* PROTOBUF_NONNULL _internal_mutable_key();
-
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
   public:
+
   // optional string value = 2;
   bool has_value() const;
-  void clear_value() ;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
   const std::string& value() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_value(Arg_&& arg, Args_... args);
-  std::string* PROTOBUF_NONNULL mutable_value();
-  [[nodiscard]] std::string* PROTOBUF_NULLABLE release_value();
-  void set_allocated_value(std::string* PROTOBUF_NULLABLE value);
-
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
   private:
   const std::string& _internal_value() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
-  std::string* PROTOBUF_NONNULL _internal_mutable_value();
-
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
   public:
+
   // @@protoc_insertion_point(class_scope:pkg.Payload)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   0, 28,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const Payload& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr key_;
-    ::google::protobuf::internal::ArenaStringPtr value_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_format_2eproto;
 };
+// -------------------------------------------------------------------
 
-extern const ::google::protobuf::internal::ClassDataFull Payload_class_data_;
+class KeyValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pkg.KeyValue) */ {
+ public:
+  inline KeyValue() : KeyValue(nullptr) {}
+  ~KeyValue() override;
+  explicit PROTOBUF_CONSTEXPR KeyValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  KeyValue(const KeyValue& from);
+  KeyValue(KeyValue&& from) noexcept
+    : KeyValue() {
+    *this = ::std::move(from);
+  }
+
+  inline KeyValue& operator=(const KeyValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeyValue& operator=(KeyValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyValue* internal_default_instance() {
+    return reinterpret_cast<const KeyValue*>(
+               &_KeyValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
+  friend void swap(KeyValue& a, KeyValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
+  // implements Message ----------------------------------------------
 
-// ===================================================================
+  KeyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyValue& from) {
+    KeyValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pkg.KeyValue";
+  }
+  protected:
+  explicit KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // optional bytes value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:pkg.KeyValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_format_2eproto;
+};
 // -------------------------------------------------------------------
 
-// Payload
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pkg.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// optional string key = 1;
-inline bool Payload::has_key() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void Payload::clear_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& Payload::key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:pkg.Payload.key)
-  return _internal_key();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void Payload::set_key(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:pkg.Payload.key)
-}
-inline std::string* PROTOBUF_NONNULL Payload::mutable_key()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:pkg.Payload.key)
-  return _s;
-}
-inline const std::string& Payload::_internal_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.key_.Get();
-}
-inline void Payload::_internal_set_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(value, GetArena());
-}
-inline std::string* PROTOBUF_NONNULL Payload::_internal_mutable_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.key_.Mutable( GetArena());
-}
-inline std::string* PROTOBUF_NULLABLE Payload::release_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:pkg.Payload.key)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
   }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.key_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.key_.Set("", GetArena());
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
   }
-  return released;
-}
-inline void Payload::set_allocated_key(std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  _impl_.key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArena());
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  // @@protoc_insertion_point(field_set_allocated:pkg.Payload.key)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-// optional string value = 2;
-inline bool Payload::has_value() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline void Payload::clear_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.value_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const std::string& Payload::value() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:pkg.Payload.value)
-  return _internal_value();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void Payload::set_value(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.value_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:pkg.Payload.value)
-}
-inline std::string* PROTOBUF_NONNULL Payload::mutable_value()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:pkg.Payload.value)
-  return _s;
-}
-inline const std::string& Payload::_internal_value() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.value_.Get();
-}
-inline void Payload::_internal_set_value(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.value_.Set(value, GetArena());
-}
-inline std::string* PROTOBUF_NONNULL Payload::_internal_mutable_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.value_.Mutable( GetArena());
-}
-inline std::string* PROTOBUF_NULLABLE Payload::release_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:pkg.Payload.value)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
   }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.value_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.value_.Set("", GetArena());
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  return released;
-}
-inline void Payload::set_allocated_value(std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
   }
-  _impl_.value_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArena());
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
   }
-  // @@protoc_insertion_point(field_set_allocated:pkg.Payload.value)
-}
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif  // __GNUC__
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace pkg
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pkg.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-// @@protoc_insertion_point(global_scope)
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-#include "google/protobuf/port_undef.inc"
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 6,
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kPrefixFieldNumber = 9,
+    kRangeEndFieldNumber = 10,
+    kCursorFieldNumber = 11,
+    kPatternFieldNumber = 13,
+    kIdFieldNumber = 4,
+    kOpFieldNumber = 3,
+    kVersionFieldNumber = 5,
+    kTtlMsFieldNumber = 7,
+    kAcceptCompressedFieldNumber = 8,
+    kResetFieldNumber = 14,
+    kLimitFieldNumber = 12,
+    kSlowThresholdUsFieldNumber = 15,
+    kDeltaFieldNumber = 17,
+    kExpectedVersionFieldNumber = 18,
+    kTraceSampleFieldNumber = 16,
+  };
+  // repeated .pkg.KeyValue entries = 6;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::pkg::KeyValue* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::KeyValue >*
+      mutable_entries();
+  private:
+  const ::pkg::KeyValue& _internal_entries(int index) const;
+  ::pkg::KeyValue* _internal_add_entries();
+  public:
+  const ::pkg::KeyValue& entries(int index) const;
+  ::pkg::KeyValue* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::KeyValue >&
+      entries() const;
+
+  // optional string key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // optional bytes value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // string prefix = 9;
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // string range_end = 10;
+  void clear_range_end();
+  const std::string& range_end() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_range_end(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_range_end();
+  PROTOBUF_NODISCARD std::string* release_range_end();
+  void set_allocated_range_end(std::string* range_end);
+  private:
+  const std::string& _internal_range_end() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_range_end(const std::string& value);
+  std::string* _internal_mutable_range_end();
+  public:
+
+  // string cursor = 11;
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
+  // string pattern = 13;
+  void clear_pattern();
+  const std::string& pattern() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pattern(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pattern();
+  PROTOBUF_NODISCARD std::string* release_pattern();
+  void set_allocated_pattern(std::string* pattern);
+  private:
+  const std::string& _internal_pattern() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pattern(const std::string& value);
+  std::string* _internal_mutable_pattern();
+  public:
+
+  // uint64 id = 4;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // .pkg.Op op = 3;
+  void clear_op();
+  ::pkg::Op op() const;
+  void set_op(::pkg::Op value);
+  private:
+  ::pkg::Op _internal_op() const;
+  void _internal_set_op(::pkg::Op value);
+  public:
+
+  // uint32 version = 5;
+  void clear_version();
+  uint32_t version() const;
+  void set_version(uint32_t value);
+  private:
+  uint32_t _internal_version() const;
+  void _internal_set_version(uint32_t value);
+  public:
+
+  // uint64 ttl_ms = 7;
+  void clear_ttl_ms();
+  uint64_t ttl_ms() const;
+  void set_ttl_ms(uint64_t value);
+  private:
+  uint64_t _internal_ttl_ms() const;
+  void _internal_set_ttl_ms(uint64_t value);
+  public:
+
+  // bool accept_compressed = 8;
+  void clear_accept_compressed();
+  bool accept_compressed() const;
+  void set_accept_compressed(bool value);
+  private:
+  bool _internal_accept_compressed() const;
+  void _internal_set_accept_compressed(bool value);
+  public:
+
+  // bool reset = 14;
+  void clear_reset();
+  bool reset() const;
+  void set_reset(bool value);
+  private:
+  bool _internal_reset() const;
+  void _internal_set_reset(bool value);
+  public:
+
+  // uint32 limit = 12;
+  void clear_limit();
+  uint32_t limit() const;
+  void set_limit(uint32_t value);
+  private:
+  uint32_t _internal_limit() const;
+  void _internal_set_limit(uint32_t value);
+  public:
+
+  // optional uint64 slow_threshold_us = 15;
+  bool has_slow_threshold_us() const;
+  private:
+  bool _internal_has_slow_threshold_us() const;
+  public:
+  void clear_slow_threshold_us();
+  uint64_t slow_threshold_us() const;
+  void set_slow_threshold_us(uint64_t value);
+  private:
+  uint64_t _internal_slow_threshold_us() const;
+  void _internal_set_slow_threshold_us(uint64_t value);
+  public:
+
+  // optional sint64 delta = 17;
+  bool has_delta() const;
+  private:
+  bool _internal_has_delta() const;
+  public:
+  void clear_delta();
+  int64_t delta() const;
+  void set_delta(int64_t value);
+  private:
+  int64_t _internal_delta() const;
+  void _internal_set_delta(int64_t value);
+  public:
+
+  // uint64 expected_version = 18;
+  void clear_expected_version();
+  uint64_t expected_version() const;
+  void set_expected_version(uint64_t value);
+  private:
+  uint64_t _internal_expected_version() const;
+  void _internal_set_expected_version(uint64_t value);
+  public:
+
+  // optional uint32 trace_sample = 16;
+  bool has_trace_sample() const;
+  private:
+  bool _internal_has_trace_sample() const;
+  public:
+  void clear_trace_sample();
+  uint32_t trace_sample() const;
+  void set_trace_sample(uint32_t value);
+  private:
+  uint32_t _internal_trace_sample() const;
+  void _internal_set_trace_sample(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pkg.Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::KeyValue > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr range_end_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pattern_;
+    uint64_t id_;
+    int op_;
+    uint32_t version_;
+    uint64_t ttl_ms_;
+    bool accept_compressed_;
+    bool reset_;
+    uint32_t limit_;
+    uint64_t slow_threshold_us_;
+    int64_t delta_;
+    uint64_t expected_version_;
+    uint32_t trace_sample_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_format_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SlowRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pkg.SlowRequest) */ {
+ public:
+  inline SlowRequest() : SlowRequest(nullptr) {}
+  ~SlowRequest() override;
+  explicit PROTOBUF_CONSTEXPR SlowRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SlowRequest(const SlowRequest& from);
+  SlowRequest(SlowRequest&& from) noexcept
+    : SlowRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SlowRequest& operator=(const SlowRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SlowRequest& operator=(SlowRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SlowRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SlowRequest* internal_default_instance() {
+    return reinterpret_cast<const SlowRequest*>(
+               &_SlowRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SlowRequest& a, SlowRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SlowRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SlowRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SlowRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SlowRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SlowRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SlowRequest& from) {
+    SlowRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SlowRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pkg.SlowRequest";
+  }
+  protected:
+  explicit SlowRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 5,
+    kSequenceFieldNumber = 1,
+    kTimestampUsFieldNumber = 2,
+    kIdFieldNumber = 4,
+    kTotalNsFieldNumber = 6,
+    kReadNsFieldNumber = 7,
+    kParseNsFieldNumber = 8,
+    kEngineNsFieldNumber = 9,
+    kWriteNsFieldNumber = 10,
+    kOpFieldNumber = 3,
+  };
+  // bytes key = 5;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint64 sequence = 1;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // int64 timestamp_us = 2;
+  void clear_timestamp_us();
+  int64_t timestamp_us() const;
+  void set_timestamp_us(int64_t value);
+  private:
+  int64_t _internal_timestamp_us() const;
+  void _internal_set_timestamp_us(int64_t value);
+  public:
+
+  // uint64 id = 4;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // uint64 total_ns = 6;
+  void clear_total_ns();
+  uint64_t total_ns() const;
+  void set_total_ns(uint64_t value);
+  private:
+  uint64_t _internal_total_ns() const;
+  void _internal_set_total_ns(uint64_t value);
+  public:
+
+  // uint64 read_ns = 7;
+  void clear_read_ns();
+  uint64_t read_ns() const;
+  void set_read_ns(uint64_t value);
+  private:
+  uint64_t _internal_read_ns() const;
+  void _internal_set_read_ns(uint64_t value);
+  public:
+
+  // uint64 parse_ns = 8;
+  void clear_parse_ns();
+  uint64_t parse_ns() const;
+  void set_parse_ns(uint64_t value);
+  private:
+  uint64_t _internal_parse_ns() const;
+  void _internal_set_parse_ns(uint64_t value);
+  public:
+
+  // uint64 engine_ns = 9;
+  void clear_engine_ns();
+  uint64_t engine_ns() const;
+  void set_engine_ns(uint64_t value);
+  private:
+  uint64_t _internal_engine_ns() const;
+  void _internal_set_engine_ns(uint64_t value);
+  public:
+
+  // uint64 write_ns = 10;
+  void clear_write_ns();
+  uint64_t write_ns() const;
+  void set_write_ns(uint64_t value);
+  private:
+  uint64_t _internal_write_ns() const;
+  void _internal_set_write_ns(uint64_t value);
+  public:
+
+  // .pkg.Op op = 3;
+  void clear_op();
+  ::pkg::Op op() const;
+  void set_op(::pkg::Op value);
+  private:
+  ::pkg::Op _internal_op() const;
+  void _internal_set_op(::pkg::Op value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pkg.SlowRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t sequence_;
+    int64_t timestamp_us_;
+    uint64_t id_;
+    uint64_t total_ns_;
+    uint64_t read_ns_;
+    uint64_t parse_ns_;
+    uint64_t engine_ns_;
+    uint64_t write_ns_;
+    int op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_format_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Result final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pkg.Result) */ {
+ public:
+  inline Result() : Result(nullptr) {}
+  ~Result() override;
+  explicit PROTOBUF_CONSTEXPR Result(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Result(const Result& from);
+  Result(Result&& from) noexcept
+    : Result() {
+    *this = ::std::move(from);
+  }
+
+  inline Result& operator=(const Result& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Result& operator=(Result&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Result& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Result* internal_default_instance() {
+    return reinterpret_cast<const Result*>(
+               &_Result_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Result& a, Result& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Result* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Result* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Result* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Result>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Result& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Result& from) {
+    Result::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Result* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pkg.Result";
+  }
+  protected:
+  explicit Result(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kCodecFieldNumber = 3,
+  };
+  // optional bytes value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // .pkg.Status status = 1;
+  void clear_status();
+  ::pkg::Status status() const;
+  void set_status(::pkg::Status value);
+  private:
+  ::pkg::Status _internal_status() const;
+  void _internal_set_status(::pkg::Status value);
+  public:
+
+  // .pkg.Codec codec = 3;
+  void clear_codec();
+  ::pkg::Codec codec() const;
+  void set_codec(::pkg::Codec value);
+  private:
+  ::pkg::Codec _internal_codec() const;
+  void _internal_set_codec(::pkg::Codec value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pkg.Result)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int status_;
+    int codec_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_format_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Response_StatsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Response_StatsEntry_DoNotUse, 
+    std::string, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Response_StatsEntry_DoNotUse, 
+    std::string, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Response_StatsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Response_StatsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Response_StatsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Response_StatsEntry_DoNotUse& other);
+  static const Response_StatsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Response_StatsEntry_DoNotUse*>(&_Response_StatsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "pkg.Response.StatsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_format_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pkg.Response) */ {
+ public:
+  inline Response() : Response(nullptr) {}
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Response(const Response& from);
+  Response(Response&& from) noexcept
+    : Response() {
+    *this = ::std::move(from);
+  }
+
+  inline Response& operator=(const Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Response& operator=(Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Response* internal_default_instance() {
+    return reinterpret_cast<const Response*>(
+               &_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Response& a, Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pkg.Response";
+  }
+  protected:
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 6,
+    kStatsFieldNumber = 8,
+    kKeysFieldNumber = 10,
+    kSlowRequestsFieldNumber = 12,
+    kValueFieldNumber = 3,
+    kMessageFieldNumber = 4,
+    kCursorFieldNumber = 11,
+    kIdFieldNumber = 1,
+    kStatusFieldNumber = 2,
+    kFoundFieldNumber = 5,
+    kTtlMsFieldNumber = 7,
+    kEntryVersionFieldNumber = 13,
+    kIntegerFieldNumber = 14,
+    kCodecFieldNumber = 9,
+  };
+  // repeated .pkg.Result results = 6;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::pkg::Result* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::Result >*
+      mutable_results();
+  private:
+  const ::pkg::Result& _internal_results(int index) const;
+  ::pkg::Result* _internal_add_results();
+  public:
+  const ::pkg::Result& results(int index) const;
+  ::pkg::Result* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::Result >&
+      results() const;
+
+  // map<string, uint64> stats = 8;
+  int stats_size() const;
+  private:
+  int _internal_stats_size() const;
+  public:
+  void clear_stats();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+      _internal_stats() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+      _internal_mutable_stats();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+      stats() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+      mutable_stats();
+
+  // repeated string keys = 10;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // repeated .pkg.SlowRequest slow_requests = 12;
+  int slow_requests_size() const;
+  private:
+  int _internal_slow_requests_size() const;
+  public:
+  void clear_slow_requests();
+  ::pkg::SlowRequest* mutable_slow_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::SlowRequest >*
+      mutable_slow_requests();
+  private:
+  const ::pkg::SlowRequest& _internal_slow_requests(int index) const;
+  ::pkg::SlowRequest* _internal_add_slow_requests();
+  public:
+  const ::pkg::SlowRequest& slow_requests(int index) const;
+  ::pkg::SlowRequest* add_slow_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::SlowRequest >&
+      slow_requests() const;
+
+  // optional bytes value = 3;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // string message = 4;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // string cursor = 11;
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // .pkg.Status status = 2;
+  void clear_status();
+  ::pkg::Status status() const;
+  void set_status(::pkg::Status value);
+  private:
+  ::pkg::Status _internal_status() const;
+  void _internal_set_status(::pkg::Status value);
+  public:
+
+  // bool found = 5;
+  void clear_found();
+  bool found() const;
+  void set_found(bool value);
+  private:
+  bool _internal_found() const;
+  void _internal_set_found(bool value);
+  public:
+
+  // int64 ttl_ms = 7;
+  void clear_ttl_ms();
+  int64_t ttl_ms() const;
+  void set_ttl_ms(int64_t value);
+  private:
+  int64_t _internal_ttl_ms() const;
+  void _internal_set_ttl_ms(int64_t value);
+  public:
+
+  // uint64 entry_version = 13;
+  void clear_entry_version();
+  uint64_t entry_version() const;
+  void set_entry_version(uint64_t value);
+  private:
+  uint64_t _internal_entry_version() const;
+  void _internal_set_entry_version(uint64_t value);
+  public:
+
+  // sint64 integer = 14;
+  void clear_integer();
+  int64_t integer() const;
+  void set_integer(int64_t value);
+  private:
+  int64_t _internal_integer() const;
+  void _internal_set_integer(int64_t value);
+  public:
+
+  // .pkg.Codec codec = 9;
+  void clear_codec();
+  ::pkg::Codec codec() const;
+  void set_codec(::pkg::Codec value);
+  private:
+  ::pkg::Codec _internal_codec() const;
+  void _internal_set_codec(::pkg::Codec value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pkg.Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::Result > results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Response_StatsEntry_DoNotUse,
+        std::string, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> stats_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::SlowRequest > slow_requests_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    uint64_t id_;
+    int status_;
+    bool found_;
+    int64_t ttl_ms_;
+    uint64_t entry_version_;
+    int64_t integer_;
+    int codec_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_format_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Payload
+
+// optional string key = 1;
+inline bool Payload::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Payload::has_key() const {
+  return _internal_has_key();
+}
+inline void Payload::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Payload::key() const {
+  // @@protoc_insertion_point(field_get:pkg.Payload.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Payload::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Payload.key)
+}
+inline std::string* Payload::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pkg.Payload.key)
+  return _s;
+}
+inline const std::string& Payload::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Payload::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Payload::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Payload::release_key() {
+  // @@protoc_insertion_point(field_release:pkg.Payload.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Payload::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Payload.key)
+}
+
+// optional string value = 2;
+inline bool Payload::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Payload::has_value() const {
+  return _internal_has_value();
+}
+inline void Payload::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Payload::value() const {
+  // @@protoc_insertion_point(field_get:pkg.Payload.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Payload::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Payload.value)
+}
+inline std::string* Payload::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:pkg.Payload.value)
+  return _s;
+}
+inline const std::string& Payload::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Payload::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Payload::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Payload::release_value() {
+  // @@protoc_insertion_point(field_release:pkg.Payload.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Payload::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Payload.value)
+}
+
+// -------------------------------------------------------------------
+
+// KeyValue
+
+// string key = 1;
+inline void KeyValue::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& KeyValue::key() const {
+  // @@protoc_insertion_point(field_get:pkg.KeyValue.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.KeyValue.key)
+}
+inline std::string* KeyValue::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pkg.KeyValue.key)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void KeyValue::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_key() {
+  // @@protoc_insertion_point(field_release:pkg.KeyValue.key)
+  return _impl_.key_.Release();
+}
+inline void KeyValue::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.KeyValue.key)
+}
+
+// optional bytes value = 2;
+inline bool KeyValue::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool KeyValue::has_value() const {
+  return _internal_has_value();
+}
+inline void KeyValue::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& KeyValue::value() const {
+  // @@protoc_insertion_point(field_get:pkg.KeyValue.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.KeyValue.value)
+}
+inline std::string* KeyValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:pkg.KeyValue.value)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void KeyValue::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:pkg.KeyValue.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void KeyValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.KeyValue.value)
+}
+
+// -------------------------------------------------------------------
+
+// Request
+
+// optional string key = 1;
+inline bool Request::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Request::has_key() const {
+  return _internal_has_key();
+}
+inline void Request::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Request::key() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Request.key)
+}
+inline std::string* Request::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pkg.Request.key)
+  return _s;
+}
+inline const std::string& Request::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Request::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_key() {
+  // @@protoc_insertion_point(field_release:pkg.Request.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Request.key)
+}
+
+// optional bytes value = 2;
+inline bool Request::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Request::has_value() const {
+  return _internal_has_value();
+}
+inline void Request::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Request::value() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Request.value)
+}
+inline std::string* Request::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:pkg.Request.value)
+  return _s;
+}
+inline const std::string& Request::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Request::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_value() {
+  // @@protoc_insertion_point(field_release:pkg.Request.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Request.value)
+}
+
+// .pkg.Op op = 3;
+inline void Request::clear_op() {
+  _impl_.op_ = 0;
+}
+inline ::pkg::Op Request::_internal_op() const {
+  return static_cast< ::pkg::Op >(_impl_.op_);
+}
+inline ::pkg::Op Request::op() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.op)
+  return _internal_op();
+}
+inline void Request::_internal_set_op(::pkg::Op value) {
+  
+  _impl_.op_ = value;
+}
+inline void Request::set_op(::pkg::Op value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.op)
+}
+
+// uint64 id = 4;
+inline void Request::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t Request::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t Request::id() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.id)
+  return _internal_id();
+}
+inline void Request::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Request::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.id)
+}
+
+// uint32 version = 5;
+inline void Request::clear_version() {
+  _impl_.version_ = 0u;
+}
+inline uint32_t Request::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint32_t Request::version() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.version)
+  return _internal_version();
+}
+inline void Request::_internal_set_version(uint32_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void Request::set_version(uint32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.version)
+}
+
+// repeated .pkg.KeyValue entries = 6;
+inline int Request::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int Request::entries_size() const {
+  return _internal_entries_size();
+}
+inline void Request::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::pkg::KeyValue* Request::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:pkg.Request.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::KeyValue >*
+Request::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:pkg.Request.entries)
+  return &_impl_.entries_;
+}
+inline const ::pkg::KeyValue& Request::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::pkg::KeyValue& Request::entries(int index) const {
+  // @@protoc_insertion_point(field_get:pkg.Request.entries)
+  return _internal_entries(index);
+}
+inline ::pkg::KeyValue* Request::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::pkg::KeyValue* Request::add_entries() {
+  ::pkg::KeyValue* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:pkg.Request.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::KeyValue >&
+Request::entries() const {
+  // @@protoc_insertion_point(field_list:pkg.Request.entries)
+  return _impl_.entries_;
+}
+
+// uint64 ttl_ms = 7;
+inline void Request::clear_ttl_ms() {
+  _impl_.ttl_ms_ = uint64_t{0u};
+}
+inline uint64_t Request::_internal_ttl_ms() const {
+  return _impl_.ttl_ms_;
+}
+inline uint64_t Request::ttl_ms() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.ttl_ms)
+  return _internal_ttl_ms();
+}
+inline void Request::_internal_set_ttl_ms(uint64_t value) {
+  
+  _impl_.ttl_ms_ = value;
+}
+inline void Request::set_ttl_ms(uint64_t value) {
+  _internal_set_ttl_ms(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.ttl_ms)
+}
+
+// bool accept_compressed = 8;
+inline void Request::clear_accept_compressed() {
+  _impl_.accept_compressed_ = false;
+}
+inline bool Request::_internal_accept_compressed() const {
+  return _impl_.accept_compressed_;
+}
+inline bool Request::accept_compressed() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.accept_compressed)
+  return _internal_accept_compressed();
+}
+inline void Request::_internal_set_accept_compressed(bool value) {
+  
+  _impl_.accept_compressed_ = value;
+}
+inline void Request::set_accept_compressed(bool value) {
+  _internal_set_accept_compressed(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.accept_compressed)
+}
+
+// string prefix = 9;
+inline void Request::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+}
+inline const std::string& Request::prefix() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Request.prefix)
+}
+inline std::string* Request::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:pkg.Request.prefix)
+  return _s;
+}
+inline const std::string& Request::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void Request::_internal_set_prefix(const std::string& value) {
+  
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_prefix() {
+  
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_prefix() {
+  // @@protoc_insertion_point(field_release:pkg.Request.prefix)
+  return _impl_.prefix_.Release();
+}
+inline void Request::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Request.prefix)
+}
+
+// string range_end = 10;
+inline void Request::clear_range_end() {
+  _impl_.range_end_.ClearToEmpty();
+}
+inline const std::string& Request::range_end() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.range_end)
+  return _internal_range_end();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_range_end(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.range_end_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Request.range_end)
+}
+inline std::string* Request::mutable_range_end() {
+  std::string* _s = _internal_mutable_range_end();
+  // @@protoc_insertion_point(field_mutable:pkg.Request.range_end)
+  return _s;
+}
+inline const std::string& Request::_internal_range_end() const {
+  return _impl_.range_end_.Get();
+}
+inline void Request::_internal_set_range_end(const std::string& value) {
+  
+  _impl_.range_end_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_range_end() {
+  
+  return _impl_.range_end_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_range_end() {
+  // @@protoc_insertion_point(field_release:pkg.Request.range_end)
+  return _impl_.range_end_.Release();
+}
+inline void Request::set_allocated_range_end(std::string* range_end) {
+  if (range_end != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.range_end_.SetAllocated(range_end, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.range_end_.IsDefault()) {
+    _impl_.range_end_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Request.range_end)
+}
+
+// string cursor = 11;
+inline void Request::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+}
+inline const std::string& Request::cursor() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Request.cursor)
+}
+inline std::string* Request::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:pkg.Request.cursor)
+  return _s;
+}
+inline const std::string& Request::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void Request::_internal_set_cursor(const std::string& value) {
+  
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_cursor() {
+  
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_cursor() {
+  // @@protoc_insertion_point(field_release:pkg.Request.cursor)
+  return _impl_.cursor_.Release();
+}
+inline void Request::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Request.cursor)
+}
+
+// uint32 limit = 12;
+inline void Request::clear_limit() {
+  _impl_.limit_ = 0u;
+}
+inline uint32_t Request::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t Request::limit() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.limit)
+  return _internal_limit();
+}
+inline void Request::_internal_set_limit(uint32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void Request::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.limit)
+}
+
+// string pattern = 13;
+inline void Request::clear_pattern() {
+  _impl_.pattern_.ClearToEmpty();
+}
+inline const std::string& Request::pattern() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.pattern)
+  return _internal_pattern();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_pattern(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pattern_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Request.pattern)
+}
+inline std::string* Request::mutable_pattern() {
+  std::string* _s = _internal_mutable_pattern();
+  // @@protoc_insertion_point(field_mutable:pkg.Request.pattern)
+  return _s;
+}
+inline const std::string& Request::_internal_pattern() const {
+  return _impl_.pattern_.Get();
+}
+inline void Request::_internal_set_pattern(const std::string& value) {
+  
+  _impl_.pattern_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_pattern() {
+  
+  return _impl_.pattern_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_pattern() {
+  // @@protoc_insertion_point(field_release:pkg.Request.pattern)
+  return _impl_.pattern_.Release();
+}
+inline void Request::set_allocated_pattern(std::string* pattern) {
+  if (pattern != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.pattern_.SetAllocated(pattern, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pattern_.IsDefault()) {
+    _impl_.pattern_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Request.pattern)
+}
+
+// bool reset = 14;
+inline void Request::clear_reset() {
+  _impl_.reset_ = false;
+}
+inline bool Request::_internal_reset() const {
+  return _impl_.reset_;
+}
+inline bool Request::reset() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.reset)
+  return _internal_reset();
+}
+inline void Request::_internal_set_reset(bool value) {
+  
+  _impl_.reset_ = value;
+}
+inline void Request::set_reset(bool value) {
+  _internal_set_reset(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.reset)
+}
+
+// optional uint64 slow_threshold_us = 15;
+inline bool Request::_internal_has_slow_threshold_us() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Request::has_slow_threshold_us() const {
+  return _internal_has_slow_threshold_us();
+}
+inline void Request::clear_slow_threshold_us() {
+  _impl_.slow_threshold_us_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Request::_internal_slow_threshold_us() const {
+  return _impl_.slow_threshold_us_;
+}
+inline uint64_t Request::slow_threshold_us() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.slow_threshold_us)
+  return _internal_slow_threshold_us();
+}
+inline void Request::_internal_set_slow_threshold_us(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.slow_threshold_us_ = value;
+}
+inline void Request::set_slow_threshold_us(uint64_t value) {
+  _internal_set_slow_threshold_us(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.slow_threshold_us)
+}
+
+// optional uint32 trace_sample = 16;
+inline bool Request::_internal_has_trace_sample() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Request::has_trace_sample() const {
+  return _internal_has_trace_sample();
+}
+inline void Request::clear_trace_sample() {
+  _impl_.trace_sample_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Request::_internal_trace_sample() const {
+  return _impl_.trace_sample_;
+}
+inline uint32_t Request::trace_sample() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.trace_sample)
+  return _internal_trace_sample();
+}
+inline void Request::_internal_set_trace_sample(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.trace_sample_ = value;
+}
+inline void Request::set_trace_sample(uint32_t value) {
+  _internal_set_trace_sample(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.trace_sample)
+}
+
+// optional sint64 delta = 17;
+inline bool Request::_internal_has_delta() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Request::has_delta() const {
+  return _internal_has_delta();
+}
+inline void Request::clear_delta() {
+  _impl_.delta_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t Request::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline int64_t Request::delta() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.delta)
+  return _internal_delta();
+}
+inline void Request::_internal_set_delta(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.delta_ = value;
+}
+inline void Request::set_delta(int64_t value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.delta)
+}
+
+// uint64 expected_version = 18;
+inline void Request::clear_expected_version() {
+  _impl_.expected_version_ = uint64_t{0u};
+}
+inline uint64_t Request::_internal_expected_version() const {
+  return _impl_.expected_version_;
+}
+inline uint64_t Request::expected_version() const {
+  // @@protoc_insertion_point(field_get:pkg.Request.expected_version)
+  return _internal_expected_version();
+}
+inline void Request::_internal_set_expected_version(uint64_t value) {
+  
+  _impl_.expected_version_ = value;
+}
+inline void Request::set_expected_version(uint64_t value) {
+  _internal_set_expected_version(value);
+  // @@protoc_insertion_point(field_set:pkg.Request.expected_version)
+}
+
+// -------------------------------------------------------------------
+
+// SlowRequest
+
+// uint64 sequence = 1;
+inline void SlowRequest::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t SlowRequest::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t SlowRequest::sequence() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.sequence)
+  return _internal_sequence();
+}
+inline void SlowRequest::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void SlowRequest::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.sequence)
+}
+
+// int64 timestamp_us = 2;
+inline void SlowRequest::clear_timestamp_us() {
+  _impl_.timestamp_us_ = int64_t{0};
+}
+inline int64_t SlowRequest::_internal_timestamp_us() const {
+  return _impl_.timestamp_us_;
+}
+inline int64_t SlowRequest::timestamp_us() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.timestamp_us)
+  return _internal_timestamp_us();
+}
+inline void SlowRequest::_internal_set_timestamp_us(int64_t value) {
+  
+  _impl_.timestamp_us_ = value;
+}
+inline void SlowRequest::set_timestamp_us(int64_t value) {
+  _internal_set_timestamp_us(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.timestamp_us)
+}
+
+// .pkg.Op op = 3;
+inline void SlowRequest::clear_op() {
+  _impl_.op_ = 0;
+}
+inline ::pkg::Op SlowRequest::_internal_op() const {
+  return static_cast< ::pkg::Op >(_impl_.op_);
+}
+inline ::pkg::Op SlowRequest::op() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.op)
+  return _internal_op();
+}
+inline void SlowRequest::_internal_set_op(::pkg::Op value) {
+  
+  _impl_.op_ = value;
+}
+inline void SlowRequest::set_op(::pkg::Op value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.op)
+}
+
+// uint64 id = 4;
+inline void SlowRequest::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t SlowRequest::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t SlowRequest::id() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.id)
+  return _internal_id();
+}
+inline void SlowRequest::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SlowRequest::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.id)
+}
+
+// bytes key = 5;
+inline void SlowRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& SlowRequest::key() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SlowRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.key)
+}
+inline std::string* SlowRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:pkg.SlowRequest.key)
+  return _s;
+}
+inline const std::string& SlowRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void SlowRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SlowRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SlowRequest::release_key() {
+  // @@protoc_insertion_point(field_release:pkg.SlowRequest.key)
+  return _impl_.key_.Release();
+}
+inline void SlowRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.SlowRequest.key)
+}
+
+// uint64 total_ns = 6;
+inline void SlowRequest::clear_total_ns() {
+  _impl_.total_ns_ = uint64_t{0u};
+}
+inline uint64_t SlowRequest::_internal_total_ns() const {
+  return _impl_.total_ns_;
+}
+inline uint64_t SlowRequest::total_ns() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.total_ns)
+  return _internal_total_ns();
+}
+inline void SlowRequest::_internal_set_total_ns(uint64_t value) {
+  
+  _impl_.total_ns_ = value;
+}
+inline void SlowRequest::set_total_ns(uint64_t value) {
+  _internal_set_total_ns(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.total_ns)
+}
+
+// uint64 read_ns = 7;
+inline void SlowRequest::clear_read_ns() {
+  _impl_.read_ns_ = uint64_t{0u};
+}
+inline uint64_t SlowRequest::_internal_read_ns() const {
+  return _impl_.read_ns_;
+}
+inline uint64_t SlowRequest::read_ns() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.read_ns)
+  return _internal_read_ns();
+}
+inline void SlowRequest::_internal_set_read_ns(uint64_t value) {
+  
+  _impl_.read_ns_ = value;
+}
+inline void SlowRequest::set_read_ns(uint64_t value) {
+  _internal_set_read_ns(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.read_ns)
+}
+
+// uint64 parse_ns = 8;
+inline void SlowRequest::clear_parse_ns() {
+  _impl_.parse_ns_ = uint64_t{0u};
+}
+inline uint64_t SlowRequest::_internal_parse_ns() const {
+  return _impl_.parse_ns_;
+}
+inline uint64_t SlowRequest::parse_ns() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.parse_ns)
+  return _internal_parse_ns();
+}
+inline void SlowRequest::_internal_set_parse_ns(uint64_t value) {
+  
+  _impl_.parse_ns_ = value;
+}
+inline void SlowRequest::set_parse_ns(uint64_t value) {
+  _internal_set_parse_ns(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.parse_ns)
+}
+
+// uint64 engine_ns = 9;
+inline void SlowRequest::clear_engine_ns() {
+  _impl_.engine_ns_ = uint64_t{0u};
+}
+inline uint64_t SlowRequest::_internal_engine_ns() const {
+  return _impl_.engine_ns_;
+}
+inline uint64_t SlowRequest::engine_ns() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.engine_ns)
+  return _internal_engine_ns();
+}
+inline void SlowRequest::_internal_set_engine_ns(uint64_t value) {
+  
+  _impl_.engine_ns_ = value;
+}
+inline void SlowRequest::set_engine_ns(uint64_t value) {
+  _internal_set_engine_ns(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.engine_ns)
+}
+
+// uint64 write_ns = 10;
+inline void SlowRequest::clear_write_ns() {
+  _impl_.write_ns_ = uint64_t{0u};
+}
+inline uint64_t SlowRequest::_internal_write_ns() const {
+  return _impl_.write_ns_;
+}
+inline uint64_t SlowRequest::write_ns() const {
+  // @@protoc_insertion_point(field_get:pkg.SlowRequest.write_ns)
+  return _internal_write_ns();
+}
+inline void SlowRequest::_internal_set_write_ns(uint64_t value) {
+  
+  _impl_.write_ns_ = value;
+}
+inline void SlowRequest::set_write_ns(uint64_t value) {
+  _internal_set_write_ns(value);
+  // @@protoc_insertion_point(field_set:pkg.SlowRequest.write_ns)
+}
+
+// -------------------------------------------------------------------
+
+// Result
+
+// .pkg.Status status = 1;
+inline void Result::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::pkg::Status Result::_internal_status() const {
+  return static_cast< ::pkg::Status >(_impl_.status_);
+}
+inline ::pkg::Status Result::status() const {
+  // @@protoc_insertion_point(field_get:pkg.Result.status)
+  return _internal_status();
+}
+inline void Result::_internal_set_status(::pkg::Status value) {
+  
+  _impl_.status_ = value;
+}
+inline void Result::set_status(::pkg::Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:pkg.Result.status)
+}
+
+// optional bytes value = 2;
+inline bool Result::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Result::has_value() const {
+  return _internal_has_value();
+}
+inline void Result::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Result::value() const {
+  // @@protoc_insertion_point(field_get:pkg.Result.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Result::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Result.value)
+}
+inline std::string* Result::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:pkg.Result.value)
+  return _s;
+}
+inline const std::string& Result::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Result::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Result::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Result::release_value() {
+  // @@protoc_insertion_point(field_release:pkg.Result.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Result::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Result.value)
+}
+
+// .pkg.Codec codec = 3;
+inline void Result::clear_codec() {
+  _impl_.codec_ = 0;
+}
+inline ::pkg::Codec Result::_internal_codec() const {
+  return static_cast< ::pkg::Codec >(_impl_.codec_);
+}
+inline ::pkg::Codec Result::codec() const {
+  // @@protoc_insertion_point(field_get:pkg.Result.codec)
+  return _internal_codec();
+}
+inline void Result::_internal_set_codec(::pkg::Codec value) {
+  
+  _impl_.codec_ = value;
+}
+inline void Result::set_codec(::pkg::Codec value) {
+  _internal_set_codec(value);
+  // @@protoc_insertion_point(field_set:pkg.Result.codec)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// Response
+
+// uint64 id = 1;
+inline void Response::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t Response::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t Response::id() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.id)
+  return _internal_id();
+}
+inline void Response::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Response::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:pkg.Response.id)
+}
+
+// .pkg.Status status = 2;
+inline void Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::pkg::Status Response::_internal_status() const {
+  return static_cast< ::pkg::Status >(_impl_.status_);
+}
+inline ::pkg::Status Response::status() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.status)
+  return _internal_status();
+}
+inline void Response::_internal_set_status(::pkg::Status value) {
+  
+  _impl_.status_ = value;
+}
+inline void Response::set_status(::pkg::Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:pkg.Response.status)
+}
+
+// optional bytes value = 3;
+inline bool Response::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Response::has_value() const {
+  return _internal_has_value();
+}
+inline void Response::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Response::value() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Response.value)
+}
+inline std::string* Response::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:pkg.Response.value)
+  return _s;
+}
+inline const std::string& Response::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Response::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_value() {
+  // @@protoc_insertion_point(field_release:pkg.Response.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Response::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Response.value)
+}
+
+// string message = 4;
+inline void Response::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& Response::message() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Response.message)
+}
+inline std::string* Response::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:pkg.Response.message)
+  return _s;
+}
+inline const std::string& Response::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void Response::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_message() {
+  // @@protoc_insertion_point(field_release:pkg.Response.message)
+  return _impl_.message_.Release();
+}
+inline void Response::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Response.message)
+}
+
+// bool found = 5;
+inline void Response::clear_found() {
+  _impl_.found_ = false;
+}
+inline bool Response::_internal_found() const {
+  return _impl_.found_;
+}
+inline bool Response::found() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.found)
+  return _internal_found();
+}
+inline void Response::_internal_set_found(bool value) {
+  
+  _impl_.found_ = value;
+}
+inline void Response::set_found(bool value) {
+  _internal_set_found(value);
+  // @@protoc_insertion_point(field_set:pkg.Response.found)
+}
+
+// repeated .pkg.Result results = 6;
+inline int Response::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int Response::results_size() const {
+  return _internal_results_size();
+}
+inline void Response::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::pkg::Result* Response::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:pkg.Response.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::Result >*
+Response::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:pkg.Response.results)
+  return &_impl_.results_;
+}
+inline const ::pkg::Result& Response::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::pkg::Result& Response::results(int index) const {
+  // @@protoc_insertion_point(field_get:pkg.Response.results)
+  return _internal_results(index);
+}
+inline ::pkg::Result* Response::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::pkg::Result* Response::add_results() {
+  ::pkg::Result* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:pkg.Response.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::Result >&
+Response::results() const {
+  // @@protoc_insertion_point(field_list:pkg.Response.results)
+  return _impl_.results_;
+}
+
+// int64 ttl_ms = 7;
+inline void Response::clear_ttl_ms() {
+  _impl_.ttl_ms_ = int64_t{0};
+}
+inline int64_t Response::_internal_ttl_ms() const {
+  return _impl_.ttl_ms_;
+}
+inline int64_t Response::ttl_ms() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.ttl_ms)
+  return _internal_ttl_ms();
+}
+inline void Response::_internal_set_ttl_ms(int64_t value) {
+  
+  _impl_.ttl_ms_ = value;
+}
+inline void Response::set_ttl_ms(int64_t value) {
+  _internal_set_ttl_ms(value);
+  // @@protoc_insertion_point(field_set:pkg.Response.ttl_ms)
+}
+
+// map<string, uint64> stats = 8;
+inline int Response::_internal_stats_size() const {
+  return _impl_.stats_.size();
+}
+inline int Response::stats_size() const {
+  return _internal_stats_size();
+}
+inline void Response::clear_stats() {
+  _impl_.stats_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+Response::_internal_stats() const {
+  return _impl_.stats_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+Response::stats() const {
+  // @@protoc_insertion_point(field_map:pkg.Response.stats)
+  return _internal_stats();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+Response::_internal_mutable_stats() {
+  return _impl_.stats_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+Response::mutable_stats() {
+  // @@protoc_insertion_point(field_mutable_map:pkg.Response.stats)
+  return _internal_mutable_stats();
+}
+
+// .pkg.Codec codec = 9;
+inline void Response::clear_codec() {
+  _impl_.codec_ = 0;
+}
+inline ::pkg::Codec Response::_internal_codec() const {
+  return static_cast< ::pkg::Codec >(_impl_.codec_);
+}
+inline ::pkg::Codec Response::codec() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.codec)
+  return _internal_codec();
+}
+inline void Response::_internal_set_codec(::pkg::Codec value) {
+  
+  _impl_.codec_ = value;
+}
+inline void Response::set_codec(::pkg::Codec value) {
+  _internal_set_codec(value);
+  // @@protoc_insertion_point(field_set:pkg.Response.codec)
+}
+
+// repeated string keys = 10;
+inline int Response::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int Response::keys_size() const {
+  return _internal_keys_size();
+}
+inline void Response::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* Response::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:pkg.Response.keys)
+  return _s;
+}
+inline const std::string& Response::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& Response::keys(int index) const {
+  // @@protoc_insertion_point(field_get:pkg.Response.keys)
+  return _internal_keys(index);
+}
+inline std::string* Response::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:pkg.Response.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void Response::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:pkg.Response.keys)
+}
+inline void Response::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:pkg.Response.keys)
+}
+inline void Response::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:pkg.Response.keys)
+}
+inline void Response::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:pkg.Response.keys)
+}
+inline std::string* Response::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void Response::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:pkg.Response.keys)
+}
+inline void Response::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:pkg.Response.keys)
+}
+inline void Response::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:pkg.Response.keys)
+}
+inline void Response::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:pkg.Response.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Response::keys() const {
+  // @@protoc_insertion_point(field_list:pkg.Response.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Response::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:pkg.Response.keys)
+  return &_impl_.keys_;
+}
+
+// string cursor = 11;
+inline void Response::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+}
+inline const std::string& Response::cursor() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pkg.Response.cursor)
+}
+inline std::string* Response::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:pkg.Response.cursor)
+  return _s;
+}
+inline const std::string& Response::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void Response::_internal_set_cursor(const std::string& value) {
+  
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_cursor() {
+  
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_cursor() {
+  // @@protoc_insertion_point(field_release:pkg.Response.cursor)
+  return _impl_.cursor_.Release();
+}
+inline void Response::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pkg.Response.cursor)
+}
+
+// repeated .pkg.SlowRequest slow_requests = 12;
+inline int Response::_internal_slow_requests_size() const {
+  return _impl_.slow_requests_.size();
+}
+inline int Response::slow_requests_size() const {
+  return _internal_slow_requests_size();
+}
+inline void Response::clear_slow_requests() {
+  _impl_.slow_requests_.Clear();
+}
+inline ::pkg::SlowRequest* Response::mutable_slow_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:pkg.Response.slow_requests)
+  return _impl_.slow_requests_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::SlowRequest >*
+Response::mutable_slow_requests() {
+  // @@protoc_insertion_point(field_mutable_list:pkg.Response.slow_requests)
+  return &_impl_.slow_requests_;
+}
+inline const ::pkg::SlowRequest& Response::_internal_slow_requests(int index) const {
+  return _impl_.slow_requests_.Get(index);
+}
+inline const ::pkg::SlowRequest& Response::slow_requests(int index) const {
+  // @@protoc_insertion_point(field_get:pkg.Response.slow_requests)
+  return _internal_slow_requests(index);
+}
+inline ::pkg::SlowRequest* Response::_internal_add_slow_requests() {
+  return _impl_.slow_requests_.Add();
+}
+inline ::pkg::SlowRequest* Response::add_slow_requests() {
+  ::pkg::SlowRequest* _add = _internal_add_slow_requests();
+  // @@protoc_insertion_point(field_add:pkg.Response.slow_requests)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pkg::SlowRequest >&
+Response::slow_requests() const {
+  // @@protoc_insertion_point(field_list:pkg.Response.slow_requests)
+  return _impl_.slow_requests_;
+}
+
+// uint64 entry_version = 13;
+inline void Response::clear_entry_version() {
+  _impl_.entry_version_ = uint64_t{0u};
+}
+inline uint64_t Response::_internal_entry_version() const {
+  return _impl_.entry_version_;
+}
+inline uint64_t Response::entry_version() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.entry_version)
+  return _internal_entry_version();
+}
+inline void Response::_internal_set_entry_version(uint64_t value) {
+  
+  _impl_.entry_version_ = value;
+}
+inline void Response::set_entry_version(uint64_t value) {
+  _internal_set_entry_version(value);
+  // @@protoc_insertion_point(field_set:pkg.Response.entry_version)
+}
+
+// sint64 integer = 14;
+inline void Response::clear_integer() {
+  _impl_.integer_ = int64_t{0};
+}
+inline int64_t Response::_internal_integer() const {
+  return _impl_.integer_;
+}
+inline int64_t Response::integer() const {
+  // @@protoc_insertion_point(field_get:pkg.Response.integer)
+  return _internal_integer();
+}
+inline void Response::_internal_set_integer(int64_t value) {
+  
+  _impl_.integer_ = value;
+}
+inline void Response::set_integer(int64_t value) {
+  _internal_set_integer(value);
+  // @@protoc_insertion_point(field_set:pkg.Response.integer)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace pkg
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::pkg::Op> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::pkg::Op>() {
+  return ::pkg::Op_descriptor();
+}
+template <> struct is_proto_enum< ::pkg::Codec> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::pkg::Codec>() {
+  return ::pkg::Codec_descriptor();
+}
+template <> struct is_proto_enum< ::pkg::Status> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::pkg::Status>() {
+  return ::pkg::Status_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
 
-#endif  // format_2eproto_2epb_2eh
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_format_2eproto
@@ -10,194 +10,1086 @@
 #include <bitset>
 #include <optional>
 #include <variant>
+#include <span>
+#include <thread>
+#include <charconv>
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
 #include "format.pb.h"
+#include "InMemoryDB.h"
+#include "Snapshot.h"
+#include "Protocol.h"
+#include "Logger.h"
+#include "Metrics.h"
+#include "Tracing.h"
 
 using boost::asio::ip::tcp;
 
-class InMemoryDB
+InMemoryDB gInMemoryDB;
+// Set by main when snapshots are enabled.
+Snapshotter* gSnapshotter {nullptr};
+
+// An op as metrics name it: its enum name without the OP_ prefix, lower case.
+static std::string OpName(std::size_t aOp)
 {
+    std::string lName = pkg::Op_Name(static_cast<pkg::Op>(aOp)).substr(3);
+    std::ranges::transform(lName, lName.begin(), [](unsigned char aChar){
+        return static_cast<char>(std::tolower(aChar));
+    });
+    return lName;
+}
+
+class Connection : public std::enable_shared_from_this<Connection>
+{
+    enum class ResponseType
+    {
+        OK,
+        ERROR,
+        MESSAGE
+    };
+
 public:
-    std::variant<bool, std::string> SetRequest(const std::string& aKey, const std::string& aValue)
-    {        
-        try
+    // A read and a write may be in flight together, so the socket runs its handlers on a strand
+    // of its own: they never run concurrently, whatever the number of io threads.
+    Connection(boost::asio::io_context& aIOContext) : mIOContext {aIOContext}, mSocket{std::make_shared<tcp::socket>(boost::asio::make_strand(mIOContext))}  {}
+
+    ~Connection()
+    {
+        if(mAccepted)
         {
-            mDB[aKey] = aValue;
-            return true;
+            Metrics::Instance().Local().mConnectionsClosed.Add(1);
         }
-        catch(const std::exception& e)
+    }
+
+    // Replies are framed like the requests and queued in mResponses; everything queued goes out
+    // in one gather write once the previous write completed, so pipelined requests cost one
+    // write and the replies stay in request order. aKeepAlive is false when the stream can no
+    // longer be trusted, the connection is closed once the reply is out.
+    template<ResponseType RT>
+    void Response(std::string_view aMessage = {"Operation completed."}, bool aKeepAlive = true)
+    {
+        std::string_view lPrefix {};
+        if constexpr(RT == ResponseType::OK)
+            lPrefix = "[OK] : ";
+        else if constexpr (RT == ResponseType::ERROR)
+            lPrefix = "[NOK] : ";
+
+        if(lPrefix.size() + aMessage.size() > MaxFrameLength(mVersion))
         {
-            std::cerr << "Error setting key-value pair in DB: " << e.what() << "\n";
-            return std::string(e.what());
-        }        
+            Response<ResponseType::ERROR>(mReplyTooLarge, aKeepAlive);
+            return;
+        }
+        EncodeLength(mVersion, static_cast<uint32_t>(lPrefix.size() + aMessage.size()), mResponses.AppendSpace(HeaderLength(mVersion)));
+        mResponses.Append(lPrefix);
+        mResponses.Append(aMessage);
+        mKeepAlive = mKeepAlive && aKeepAlive;
     }
 
-    std::optional<std::string> GetRequest(const std::string& aKey)
+    // A stored value goes out by reference, without being copied, unless it has to be
+    // decompressed.
+    void Response(InMemoryDB::ValueHandle aValue)
     {
-        std::cout << "Searching for key :" << aKey << "\n";
-        if(mDB.contains(aKey) == false)
+        if(WireSize(*aValue) > MaxFrameLength(mVersion))
         {
-            std::cout << "Key not found in DB return nullopt\n";
-            return std::nullopt;
+            Response<ResponseType::ERROR>(mReplyTooLarge);
+            return;
         }
-        std::cout << "Key found in DB return " << mDB[aKey] << "\n";
-        return mDB[aKey];
+        EncodeLength(mVersion, static_cast<uint32_t>(WireSize(*aValue)), mResponses.AppendSpace(HeaderLength(mVersion)));
+        AppendValue(std::move(aValue));
+    }
+
+    // First read on a new connection: a client speaking BINARY_V2 opens with the protocol
+    // preamble, anything else is the start of an ASCII_V1 header.
+    void DetectProtocol()
+    {
+        mAccepted = true;
+        Metrics::Instance().Local().mConnectionsOpened.Add(1);
+        char* lTail = mRecvBuffer.Prepare(FrameBuffer::mMinReadSize);
+        boost::asio::async_read(*mSocket.get(), boost::asio::buffer(lTail, mRecvBuffer.FreeSpace()), boost::asio::transfer_at_least(gProtocolPreambleLength),
+            [me=shared_from_this()](const boost::system::error_code& aError, size_t aBytesTransferred){
+            if(aError)
+            {
+                LOG_ERROR("Error reading from client: ", aError.message());
+                return;
+            }
+
+            Metrics::Instance().Local().mBytesIn.Add(aBytesTransferred);
+            me->mReadAt = RequestTrace::Clock::now();
+            me->mRecvBuffer.Commit(aBytesTransferred);
+            if(IsProtocolPreamble(me->mRecvBuffer.Readable().data()) == false)
+            {
+                me->mVersion = ProtocolVersion::ASCII_V1;
+                me->ProcessFrames();
+                return;
+            }
+
+            me->mVersion = ProtocolVersion::BINARY_V2;
+            me->mRecvBuffer.Consume(gProtocolPreambleLength);
+            me->mResponses.Append(std::string_view(gProtocolPreamble, gProtocolPreambleLength));
+            me->ProcessFrames();
+        });
     }
 
+    std::shared_ptr<tcp::socket> GetSocket() 
+    { 
+        return mSocket; 
+    }
+
+    void Close()
+    {
+        boost::system::error_code lError;
+        mSocket->shutdown(tcp::socket::shutdown_both, lError);
+        mSocket->close(lError);
+    }
+
+
 private:
-    std::unordered_map<std::string, std::string> mDB;
-};
+    // Handles the complete frames in the receive buffer and flushes the replies, then reads the
+    // bytes still missing for the next frame. Backpressure: once mMaxQueuedBytes of replies wait
+    // to be written the connection stops handling frames and reading, until a write completes,
+    // so a client that does not read its replies cannot grow the server's memory; it stalls on
+    // its own socket buffers instead.
+    //
+    // A frame's header counts as read when the read that completed it finished, and so does its
+    // body; a frame whose header came in before the rest keeps the time of that earlier read.
+    void ProcessFrames()
+    {
+        std::string_view lFrame {};
+        std::size_t lMissing {0};
+        FrameStatus lStatus {FrameStatus::INCOMPLETE};
+        while(mKeepAlive && Congested() == false && (lStatus = mRecvBuffer.NextFrame(mVersion, lFrame, lMissing)) == FrameStatus::COMPLETE)
+        {
+            const auto lStart = RequestTrace::Clock::now();
+            mTracing = Tracer::Instance().Enabled();
+            HandleRequest(lFrame);
+            const auto lExecuted = RequestTrace::Clock::now();
+            Metrics::Instance().RecordOp(static_cast<std::size_t>(mRequest.op()), lExecuted - lStart);
+            if(mTracing)
+            {
+                TraceRequest(lStart, lExecuted);
+            }
+            mHeaderReadAt = {};
+        }
+        if(lStatus == FrameStatus::INCOMPLETE && mHeaderReadAt == RequestTrace::Clock::time_point{} &&
+           mRecvBuffer.Readable().size() >= HeaderLength(mVersion))
+        {
+            mHeaderReadAt = mReadAt;
+        }
 
-InMemoryDB gInMemoryDB;
+        if(lStatus == FrameStatus::INVALID)
+        {
+            LOG_WARNING("Invalid message header.");
+            Response<ResponseType::ERROR>("Invalid message header", false);
+        }
 
-class Connection : public std::enable_shared_from_this<Connection>
-{
-    enum class ResponseType
+        Flush();
+        if(mKeepAlive == false)
+        {
+            return;
+        }
+        if(Congested())
+        {
+            mReadPaused = true;
+            Metrics::Instance().Local().mBackpressurePauses.Add(1);
+            return;
+        }
+        ReadFrames(lMissing);
+    }
+
+    // aStart is taken before parsing; when the request did not parse it stands for mParsedAt.
+    void TraceRequest(RequestTrace::Clock::time_point aStart, RequestTrace::Clock::time_point aExecuted)
     {
-        OK,
-        ERROR,
-        MESSAGE
-    };
+        RequestTrace& lTrace = mTraces.emplace_back();
+        lTrace.mHeaderRead = mHeaderReadAt != RequestTrace::Clock::time_point{} ? mHeaderReadAt : mReadAt;
+        lTrace.mBodyRead = mReadAt;
+        lTrace.mParsed = std::max(mParsedAt, aStart);
+        lTrace.mExecuted = aExecuted;
+        lTrace.mId = mRequest.id();
+        lTrace.mOp = static_cast<uint32_t>(mRequest.op());
+        lTrace.mOpName = pkg::Op_Name(mRequest.op());
+        lTrace.mKey = std::string_view(mRequest.key()).substr(0, RequestTrace::mMaxKeyLength);
+        lTrace.mSampled = Tracer::Instance().Sample();
+    }
 
-public:
-    Connection(boost::asio::io_context& aIOContext) : mIOContext {aIOContext}, mSocket{std::make_shared<tcp::socket>(mIOContext)}  {}
+    bool Congested() const
+    {
+        return mResponses.Size() + mInFlight.Size() >= mMaxQueuedBytes;
+    }
 
-    template<ResponseType RT>
-    void Response(const std::string& aMessage = {"Operation completed."})
+    // Composed read: returns once at least aMissing bytes, or a step of FrameBuffer::mMaxReadStep
+    // of them, arrived, but takes whatever else the socket already holds so that pipelined frames
+    // are picked up by the same read. ProcessFrames reads on until the frame is complete.
+    void ReadFrames(std::size_t aMissing)
     {
-        std::string lResp {};
-        if constexpr(RT == ResponseType::OK)
-            lResp = "[OK] : ";
-        else if constexpr (RT == ResponseType::ERROR)
-            lResp = "[NOK] : ";
-        
-        lResp += aMessage;
-            
-        boost::asio::async_write(*mSocket.get(), boost::asio::buffer(lResp), [](const boost::system::error_code& aError, size_t aBytesTransferred){
-            if(!aError)
+        const std::size_t lStep = std::min(aMissing, FrameBuffer::mMaxReadStep);
+        char* lTail = mRecvBuffer.Prepare(std::max(lStep, FrameBuffer::mMinReadSize));
+        boost::asio::async_read(*mSocket.get(), boost::asio::buffer(lTail, mRecvBuffer.FreeSpace()), boost::asio::transfer_at_least(lStep),
+            [me=shared_from_this()](const boost::system::error_code& aError, size_t aBytesTransferred){
+            if(aError == boost::asio::error::eof && me->mRecvBuffer.Readable().empty())
             {
-                std::cout << "Nr of " << aBytesTransferred << " bytes sent to client.\n";
+                LOG_DEBUG("Client closed the connection.");
+            }
+            else if(aError)
+            {
+                LOG_ERROR("Error reading from client: ", aError.message());
             }
             else
             {
-                std::cerr << "Error sending response to client: " << aError.message() << "\n";
+                Metrics::Instance().Local().mBytesIn.Add(aBytesTransferred);
+                me->mReadAt = RequestTrace::Clock::now();
+                me->mRecvBuffer.Commit(aBytesTransferred);
+                me->ProcessFrames();
             }
         });
     }
 
-    void ReadMsgLength() 
+    // Starts writing the queued replies unless a write is already in flight; replies queued in
+    // the meantime are sent together by the next one. A paused connection picks up where it
+    // stopped once the write brought the queue back under the limit.
+    void Flush()
     {
-        std::cout << "Connection::ReadMsgLength " << std::this_thread::get_id() <<"\n";
-        mSocket->async_read_some(boost::asio::buffer(mHeaderBuffer, mMsgHeaderLength), [me=shared_from_this()](const boost::system::error_code& aError, size_t aBytesTransferred){
+        if(mWriting || mResponses.Empty())
+        {
+            return;
+        }
+        std::swap(mResponses, mInFlight);
+        std::swap(mTraces, mInFlightTraces);
+        mWriteBuffers.clear();
+        mInFlight.ForEachSegment([this](const char* aData, std::size_t aLength){
+            mWriteBuffers.emplace_back(aData, aLength);
+        });
+
+        mWriting = true;
+        Metrics::Instance().Local().mQueuedBytes.Add(mInFlight.Size());
+        boost::asio::async_write(*mSocket.get(), mWriteBuffers, [me=shared_from_this()](const boost::system::error_code& aError, size_t aBytesTransferred){
+            me->mWriting = false;
+            ThreadMetrics& lMetrics = Metrics::Instance().Local();
+            lMetrics.mQueuedBytes.Add(0 - me->mInFlight.Size());
+            lMetrics.mBytesOut.Add(aBytesTransferred);
             if(aError)
             {
-                std::cerr << "Error reading from client: " << aError.message() << "\n";
-                me->Response<ResponseType::ERROR>("Error reading from client" + aError.message());
+                LOG_ERROR("Error sending response to client: ", aError.message());
+                return;
             }
-            else if(aBytesTransferred != me->mMsgHeaderLength)
+
+            me->mInFlight.Clear();
+            if(me->mInFlightTraces.empty() == false)
             {
-                std::cerr << "Invalid message: " << me->mMsgHeaderLength << " bytes expected, but only " << aBytesTransferred << " bytes received.\n";
-                me->Response<ResponseType::ERROR>("Wrong number of bytes received");
+                const auto lWritten = RequestTrace::Clock::now();
+                for(RequestTrace& lTrace : me->mInFlightTraces)
+                {
+                    lTrace.mWritten = lWritten;
+                    Tracer::Instance().Finish(std::move(lTrace));
+                }
+                me->mInFlightTraces.clear();
             }
-            else
+            if(me->mResponses.Empty() == false)
+            {
+                me->Flush();
+            }
+            else if(me->mKeepAlive == false)
+            {
+                me->Close();
+            }
+            if(me->mReadPaused && me->mKeepAlive && me->Congested() == false)
             {
-                uint32_t const lMsgLength = me->ConvertTo<uint32_t>(std::string(me->mHeaderBuffer));
-                me->ReadNoBytes(lMsgLength);
+                me->mReadPaused = false;
+                me->ProcessFrames();
             }
         });
     }
 
-    void ReadNoBytes(uint32_t aMsgLength)
+    // The request message is reused between frames so parsing does not reallocate the key, and
+    // the value is moved out of it into the store. Requests carrying an op are dispatched through
+    // a table indexed by the op; requests without one are legacy Payloads.
+    void HandleRequest(std::string_view aFrame)
     {
-        std::cout << "Connection::ReadNoBytes" << std::this_thread::get_id() <<"\n";
+        using RequestHandler = void (Connection::*)();
+        static constexpr std::array<RequestHandler, pkg::Op_ARRAYSIZE> lHandlers {
+            &Connection::HandleLegacyRequest,   // OP_UNSPECIFIED
+            &Connection::HandleGet,             // OP_GET
+            &Connection::HandleSet,             // OP_SET
+            &Connection::HandleDel,             // OP_DEL
+            &Connection::HandleExists,          // OP_EXISTS
+            &Connection::HandlePing,            // OP_PING
+            &Connection::HandleMultiGet,        // OP_MGET
+            &Connection::HandleMultiSet,        // OP_MSET
+            &Connection::HandleMultiDel,        // OP_MDEL
+            &Connection::HandleExpire,          // OP_EXPIRE
+            &Connection::HandleTtl,             // OP_TTL
+            &Connection::HandleStats,           // OP_STATS
+            &Connection::HandleSnapshot,        // OP_SNAPSHOT
+            &Connection::HandleRangeScan,       // OP_RANGE_SCAN
+            &Connection::HandleScan,            // OP_SCAN
+            &Connection::HandleSlowLog,         // OP_SLOWLOG
+            &Connection::HandleTrace,           // OP_TRACE
+            &Connection::HandleIncrBy,          // OP_INCRBY
+            &Connection::HandleAppend,          // OP_APPEND
+            &Connection::HandleGetSet,          // OP_GETSET
+            &Connection::HandleSetNx,           // OP_SETNX
+            &Connection::HandleCas              // OP_CAS
+        };
 
-        mReadBuffer.resize(aMsgLength);
-        mSocket->async_read_some(boost::asio::buffer(mReadBuffer), [aMsgLength, me=shared_from_this()](const boost::system::error_code& aError, size_t aBytesTransferred){
-            if(aError)
+        if(mRequest.ParseFromArray(aFrame.data(), static_cast<int>(aFrame.size())) == false)
+        {
+            if(mStructuredReplies)
+            {
+                mResponse.Clear();
+                Reply(pkg::STATUS_BAD_REQUEST, "Malformed request.");
+            }
+            else
+            {
+                Response<ResponseType::ERROR>("Malformed request.");
+            }
+            return;
+        }
+        if(mTracing)
+        {
+            mParsedAt = RequestTrace::Clock::now();
+        }
+
+        const auto lOp = static_cast<std::size_t>(mRequest.op());
+        mStructuredReplies = lOp != pkg::OP_UNSPECIFIED;
+        mAcceptCompressed = mRequest.accept_compressed();
+        mResponse.Clear();
+        mResponse.set_id(mRequest.id());
+        if(lOp >= lHandlers.size())
+        {
+            Reply(pkg::STATUS_UNSUPPORTED, "Unsupported operation.");
+            return;
+        }
+        if(mRequest.ttl_ms() > InMemoryDB::mMaxTtlMs)
+        {
+            Reply(pkg::STATUS_BAD_REQUEST, "TTL too large.");
+            return;
+        }
+        (this->*lHandlers[lOp])();
+    }
+
+    void HandleGet()
+    {
+        uint64_t lVersion {0};
+        InMemoryDB::ValueHandle lValue = gInMemoryDB.GetRequest(mRequest.key(), &lVersion);
+        if(lValue == nullptr)
+        {
+            Reply(pkg::STATUS_NOT_FOUND);
+            return;
+        }
+        mResponse.set_entry_version(lVersion);
+        Reply(pkg::STATUS_OK, {}, std::move(lValue));
+    }
+
+    void HandleSet()
+    {
+        auto result = gInMemoryDB.SetRequest(mRequest.key(), std::move(*mRequest.mutable_value()), mRequest.ttl_ms());
+        if(std::holds_alternative<std::string>(result))
+        {
+            Reply(pkg::STATUS_ERROR, std::get<std::string>(result));
+            return;
+        }
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleIncrBy()
+    {
+        uint64_t lVersion {0};
+        auto lResult = gInMemoryDB.IncrByRequest(mRequest.key(), mRequest.has_delta() ? mRequest.delta() : 1, &lVersion);
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            Reply(pkg::STATUS_ERROR, std::get<std::string>(lResult));
+            return;
+        }
+        mResponse.set_integer(std::get<int64_t>(lResult));
+        mResponse.set_entry_version(lVersion);
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleAppend()
+    {
+        uint64_t lVersion {0};
+        auto lResult = gInMemoryDB.AppendRequest(mRequest.key(), mRequest.value(), &lVersion);
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            Reply(pkg::STATUS_ERROR, std::get<std::string>(lResult));
+            return;
+        }
+        mResponse.set_integer(static_cast<int64_t>(std::get<std::size_t>(lResult)));
+        mResponse.set_entry_version(lVersion);
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleGetSet()
+    {
+        uint64_t lVersion {0};
+        auto lResult = gInMemoryDB.GetSetRequest(mRequest.key(), std::move(*mRequest.mutable_value()), mRequest.ttl_ms(), &lVersion);
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            Reply(pkg::STATUS_ERROR, std::get<std::string>(lResult));
+            return;
+        }
+        InMemoryDB::ValueHandle& lPrevious = std::get<InMemoryDB::ValueHandle>(lResult);
+        mResponse.set_found(lPrevious != nullptr);
+        mResponse.set_entry_version(lVersion);
+        Reply(pkg::STATUS_OK, {}, std::move(lPrevious));
+    }
+
+    void HandleSetNx()
+    {
+        uint64_t lVersion {0};
+        auto lResult = gInMemoryDB.SetIfAbsentRequest(mRequest.key(), std::move(*mRequest.mutable_value()), mRequest.ttl_ms(), &lVersion);
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            Reply(pkg::STATUS_ERROR, std::get<std::string>(lResult));
+            return;
+        }
+        mResponse.set_found(std::get<bool>(lResult) == false);
+        mResponse.set_entry_version(lVersion);
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleCas()
+    {
+        uint64_t lVersion {0};
+        auto lResult = gInMemoryDB.CompareAndSetRequest(mRequest.key(), mRequest.expected_version(), std::move(*mRequest.mutable_value()), mRequest.ttl_ms(), &lVersion);
+        if(std::holds_alternative<std::string>(lResult))
+        {
+            Reply(pkg::STATUS_ERROR, std::get<std::string>(lResult));
+            return;
+        }
+        mResponse.set_entry_version(lVersion);
+        switch(std::get<InMemoryDB::CasResult>(lResult))
+        {
+            case InMemoryDB::CasResult::STORED:
+                Reply(pkg::STATUS_OK);
+                break;
+            case InMemoryDB::CasResult::NOT_FOUND:
+                Reply(pkg::STATUS_NOT_FOUND);
+                break;
+            case InMemoryDB::CasResult::CONFLICT:
+                Reply(pkg::STATUS_CONFLICT, "Version changed.");
+                break;
+        }
+    }
+
+    void HandleDel()
+    {
+        mResponse.set_found(gInMemoryDB.DelRequest(mRequest.key()));
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleExists()
+    {
+        mResponse.set_found(gInMemoryDB.ExistsRequest(mRequest.key()));
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleExpire()
+    {
+        Reply(gInMemoryDB.ExpireRequest(mRequest.key(), mRequest.ttl_ms()) ? pkg::STATUS_OK : pkg::STATUS_NOT_FOUND);
+    }
+
+    void HandleTtl()
+    {
+        std::optional<int64_t> lTtl = gInMemoryDB.TtlRequest(mRequest.key());
+        if(lTtl.has_value() == false)
+        {
+            Reply(pkg::STATUS_NOT_FOUND);
+            return;
+        }
+        mResponse.set_ttl_ms(lTtl.value());
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleStats()
+    {
+        const InMemoryDB::Stats lStats = gInMemoryDB.GetStats();
+        auto& lCounters = *mResponse.mutable_stats();
+        lCounters["keys"] = lStats.mKeys;
+        lCounters["used_memory"] = lStats.mUsedMemory;
+        lCounters["max_memory"] = lStats.mMaxMemory;
+        lCounters["evicted_keys"] = lStats.mEvicted;
+        lCounters["expired_keys"] = lStats.mExpired;
+        lCounters["slab_used_bytes"] = lStats.mSlabUsed;
+        lCounters["slab_allocated_bytes"] = lStats.mSlabAllocated;
+        lCounters["compacted_values"] = lStats.mCompacted;
+        lCounters["index_slots"] = lStats.mIndexSlots;
+        lCounters["aof_write_errors"] = lStats.mLogWriteErrors;
+        lCounters["aof_failed"] = lStats.mLogFailed ? 1 : 0;
+        lCounters["resident_memory"] = ResidentMemory();
+
+        const Metrics::Totals lTotals = Metrics::Instance().Collect();
+        lCounters["connections"] = lTotals.mConnectionsOpened - lTotals.mConnectionsClosed;
+        lCounters["connections_total"] = lTotals.mConnectionsOpened;
+        lCounters["bytes_in"] = lTotals.mBytesIn;
+        lCounters["bytes_out"] = lTotals.mBytesOut;
+        lCounters["queued_reply_bytes"] = lTotals.mQueuedBytes;
+        lCounters["backpressure_pauses"] = lTotals.mBackpressurePauses;
+        for(std::size_t i = 0; i < static_cast<std::size_t>(pkg::Op_ARRAYSIZE); ++i)
+        {
+            const Metrics::OpTotals& lOp = lTotals.mOps[i];
+            if(lOp.mCount == 0)
             {
-                std::cerr << "Error reading from client: " << aError.message() << "\n";
-                me->Response<ResponseType::ERROR>("Error reading from client" + aError.message());
+                continue;
             }
-            else if(aBytesTransferred != (aMsgLength))
+            const std::string lName = OpName(i);
+            lCounters[lName + "_calls"] = lOp.mCount;
+            lCounters[lName + "_usec"] = lOp.mNanos / 1000;
+            lCounters[lName + "_p50_ns"] = lOp.Percentile(0.5);
+            lCounters[lName + "_p99_ns"] = lOp.Percentile(0.99);
+            lCounters[lName + "_p999_ns"] = lOp.Percentile(0.999);
+        }
+        Reply(pkg::STATUS_OK, ToString(lStats.mPolicy));
+    }
+
+    void HandleSnapshot()
+    {
+        if(gSnapshotter == nullptr)
+        {
+            Reply(pkg::STATUS_ERROR, "Snapshots are not enabled.");
+            return;
+        }
+        if(gSnapshotter->Request() == false)
+        {
+            Reply(pkg::STATUS_ERROR, "A snapshot is already in progress.");
+            return;
+        }
+        Reply(pkg::STATUS_OK, "Snapshot started.");
+    }
+
+    // One page of keys per request; a full page hands its last key back as the cursor to
+    // resume after, so a long scan never holds a shard lock across pages.
+    void HandleRangeScan()
+    {
+        if(gInMemoryDB.OrderedIndexEnabled() == false)
+        {
+            Reply(pkg::STATUS_UNSUPPORTED, "The ordered index is not enabled.");
+            return;
+        }
+
+        InMemoryDB::RangeScan lScan;
+        lScan.mFrom = mRequest.cursor().empty() ? std::string_view(mRequest.key()) : std::string_view(mRequest.cursor());
+        lScan.mExclusive = mRequest.cursor().empty() == false;
+        lScan.mTo = mRequest.range_end();
+        lScan.mPrefix = mRequest.prefix();
+        lScan.mLimit = mRequest.limit() == 0 ? mDefaultScanLimit : std::min<std::size_t>(mRequest.limit(), mMaxScanLimit);
+
+        mScanKeys.clear();
+        gInMemoryDB.RangeScanRequest(lScan, mScanKeys);
+        if(mScanKeys.size() == lScan.mLimit)
+        {
+            mResponse.set_cursor(mScanKeys.back());
+        }
+        for(std::string& lKey : mScanKeys)
+        {
+            mResponse.add_keys(std::move(lKey));
+        }
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleScan()
+    {
+        uint64_t lCursor {0};
+        const std::string& lText = mRequest.cursor();
+        if(lText.empty() == false)
+        {
+            auto [lPtr, lError] = std::from_chars(lText.data(), lText.data() + lText.size(), lCursor);
+            if(lError != std::errc{} || lPtr != lText.data() + lText.size())
             {
-                std::cerr << "Invalid message: " << (aMsgLength) << " bytes expected, but " << aBytesTransferred << " bytes received.\n";
-                me->Response<ResponseType::ERROR>("Wrong number of bytes received");
+                Reply(pkg::STATUS_BAD_REQUEST, "Invalid cursor.");
+                return;
+            }
+        }
+        const std::size_t lCount = mRequest.limit() == 0 ? mDefaultScanCount : std::min<std::size_t>(mRequest.limit(), mMaxScanLimit);
+
+        mScanKeys.clear();
+        lCursor = gInMemoryDB.ScanRequest(lCursor, mRequest.pattern(), lCount, mScanKeys);
+        mResponse.set_cursor(std::to_string(lCursor));
+        for(std::string& lKey : mScanKeys)
+        {
+            mResponse.add_keys(std::move(lKey));
+        }
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleSlowLog()
+    {
+        const std::size_t lLimit = mRequest.limit() == 0 ? SIZE_MAX : mRequest.limit();
+        for(const SlowRequest& lSlow : Tracer::Instance().SlowRequests(lLimit))
+        {
+            const RequestTrace& lTrace = lSlow.mTrace;
+            pkg::SlowRequest& lEntry = *mResponse.add_slow_requests();
+            lEntry.set_sequence(lSlow.mSequence);
+            lEntry.set_timestamp_us(std::chrono::duration_cast<std::chrono::microseconds>(lSlow.mLoggedAt.time_since_epoch()).count());
+            lEntry.set_op(static_cast<pkg::Op>(lTrace.mOp));
+            lEntry.set_id(lTrace.mId);
+            lEntry.set_key(lTrace.mKey);
+            lEntry.set_total_ns(static_cast<uint64_t>(lTrace.Total().count()));
+            lEntry.set_read_ns(static_cast<uint64_t>(lTrace.Read().count()));
+            lEntry.set_parse_ns(static_cast<uint64_t>(lTrace.Parse().count()));
+            lEntry.set_engine_ns(static_cast<uint64_t>(lTrace.Engine().count()));
+            lEntry.set_write_ns(static_cast<uint64_t>(lTrace.Write().count()));
+        }
+        if(mRequest.reset())
+        {
+            Tracer::Instance().ResetSlowLog();
+        }
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleTrace()
+    {
+        Tracer& lTracer = Tracer::Instance();
+        if(mRequest.has_slow_threshold_us())
+        {
+            lTracer.SetSlowThreshold(std::chrono::microseconds{static_cast<int64_t>(std::min<uint64_t>(mRequest.slow_threshold_us(), INT64_MAX))});
+        }
+        if(mRequest.has_trace_sample())
+        {
+            lTracer.SetSampleEvery(mRequest.trace_sample());
+        }
+        auto& lSettings = *mResponse.mutable_stats();
+        lSettings["slow_threshold_us"] = static_cast<uint64_t>(lTracer.SlowThreshold().count());
+        lSettings["trace_sample"] = lTracer.SampleEvery();
+        lSettings["slowlog_length"] = lTracer.SlowLogLength();
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandlePing()
+    {
+        Reply(pkg::STATUS_OK);
+    }
+
+    void CollectBatchKeys()
+    {
+        mBatchKeys.clear();
+        for(const auto& lEntry : mRequest.entries())
+        {
+            mBatchKeys.emplace_back(lEntry.key());
+        }
+    }
+
+    void HandleMultiGet()
+    {
+        CollectBatchKeys();
+        gInMemoryDB.MultiGetRequest(mBatchKeys, mBatchValues);
+        ReplyResults(mBatchValues);
+        mBatchValues.clear();
+    }
+
+    void HandleMultiSet()
+    {
+        CollectBatchKeys();
+        mBatchPayloads.clear();
+        for(auto& lEntry : *mRequest.mutable_entries())
+        {
+            mBatchPayloads.push_back(std::move(*lEntry.mutable_value()));
+        }
+
+        auto result = gInMemoryDB.MultiSetRequest(mBatchKeys, mBatchPayloads, mRequest.ttl_ms());
+        if(std::holds_alternative<std::string>(result))
+        {
+            Reply(pkg::STATUS_ERROR, std::get<std::string>(result));
+            return;
+        }
+        Reply(pkg::STATUS_OK);
+    }
+
+    void HandleMultiDel()
+    {
+        CollectBatchKeys();
+        gInMemoryDB.MultiDelRequest(mBatchKeys, mBatchFound);
+        for(const bool lFound : mBatchFound)
+        {
+            mResponse.add_results()->set_status(lFound ? pkg::STATUS_OK : pkg::STATUS_NOT_FOUND);
+        }
+        Reply(pkg::STATUS_OK);
+    }
+
+    // Legacy Payload: an empty value reads the key, anything else stores it. Text replies.
+    void HandleLegacyRequest()
+    {
+        const std::string& lKey = mRequest.key();
+        if(mRequest.value().empty())
+        {
+            InMemoryDB::ValueHandle lValue = gInMemoryDB.GetRequest(lKey);
+            if(lValue == nullptr)
+            {
+                Response<ResponseType::ERROR>("Key not found in DB.");
             }
             else
             {
-                pkg::Payload lPayload {};
-                std::string lMessage (me->mReadBuffer.begin(), me->mReadBuffer.end());
-                lPayload.ParseFromString(lMessage);
+                Response(std::move(lValue));
+            }
+        }
+        else
+        {
+            auto result = gInMemoryDB.SetRequest(lKey, std::move(*mRequest.mutable_value()));
+            if(std::holds_alternative<std::string>(result))
+            {
+                std::string tempString = "Error setting key-value pair in DB." + std::get<std::string>(result);
+                Response<ResponseType::ERROR>(tempString);
+            }
+            else
+            {
+                Response<ResponseType::OK>();
+            }                        
+        }
+    }
 
-                std::string const lKey = lPayload.key();
-                std::string const lValue = lPayload.value();
-                std::cout << "Key : " << lKey << " , " << " Value : " << lValue << "\n";
-                if(lValue.empty())
-                {
-                    std::optional<std::string> lTempValue = gInMemoryDB.GetRequest(lKey);
-                    if(lTempValue.has_value() == false)
-                    {
-                        me->Response<ResponseType::ERROR>("Key not found in DB.");
-                    }
-                    else
-                    {
-                        me->Response<ResponseType::MESSAGE>(lTempValue.value());
-                    }                    
-                }
-                else
-                {
-                    auto result = gInMemoryDB.SetRequest(lKey, lValue);
-                    if(std::holds_alternative<std::string>(result))
-                    {
-                        std::string tempString = "Error setting key-value pair in DB." + std::get<std::string>(result);
-                        me->Response<ResponseType::ERROR>(tempString);
-                    }
-                    else
-                    {
-                        me->Response<ResponseType::OK>();
-                    }                        
-                }
+    // Queues mResponse as a structured reply. The value field is not set on the message but
+    // appended after the serialized envelope (protobuf fields may come in any order), so the
+    // stored value is referenced instead of being copied into the serialized bytes.
+    void Reply(pkg::Status aStatus, std::string_view aMessage = {}, InMemoryDB::ValueHandle aValue = nullptr)
+    {
+        mResponse.set_status(aStatus);
+        if(aMessage.empty() == false)
+        {
+            mResponse.set_message(std::string(aMessage));
+        }
+        if(aValue != nullptr && SendsCompressed(*aValue))
+        {
+            mResponse.set_codec(static_cast<pkg::Codec>(aValue->GetCodec()));
+        }
+
+        const std::size_t lEnvelopeLength = mResponse.ByteSizeLong();
+        char lValueField[1 + gMaxVarintLength];
+        std::size_t lValueFieldLength {0};
+        std::size_t lValueLength {0};
+        if(aValue != nullptr)
+        {
+            lValueLength = WireSize(*aValue);
+            lValueField[0] = static_cast<char>((pkg::Response::kValueFieldNumber << 3) | 2);
+            lValueFieldLength = 1 + EncodeVarint(lValueLength, lValueField + 1);
+        }
+
+        const std::size_t lTotalLength = lEnvelopeLength + lValueFieldLength + lValueLength;
+        if(lTotalLength > MaxFrameLength(mVersion))
+        {
+            ReplyTooLarge();
+            return;
+        }
+        EncodeLength(mVersion, static_cast<uint32_t>(lTotalLength), mResponses.AppendSpace(HeaderLength(mVersion)));
+        mResponse.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(mResponses.AppendSpace(lEnvelopeLength)));
+        if(aValue != nullptr)
+        {
+            mResponses.Append(std::string_view(lValueField, lValueFieldLength));
+            AppendValue(std::move(aValue));
+        }
+    }
+
+    // Replaces a reply whose length the connection's frame header cannot carry by an error.
+    void ReplyTooLarge()
+    {
+        const uint64_t lId = mResponse.id();
+        mResponse.Clear();
+        mResponse.set_id(lId);
+        Reply(pkg::STATUS_ERROR, mReplyTooLarge);
+    }
+
+    // Queues an MGET reply. Like Reply, each pkg::Result is encoded by hand after the envelope so
+    // the values are referenced rather than copied. A missing key is a Result with only a
+    // NOT_FOUND status, a present one a Result with a value, preceded by its codec when sent
+    // compressed.
+    void ReplyResults(std::span<const InMemoryDB::ValueHandle> aValues)
+    {
+        auto lResultLength = [this](const InMemoryDB::ValueHandle& aValue) -> std::size_t {
+            if(aValue == nullptr)
+            {
+                return 2;
             }
-        });
+            const std::size_t lCodecLength = SendsCompressed(*aValue) ? 2 : 0;
+            return lCodecLength + 1 + VarintLength(WireSize(*aValue)) + WireSize(*aValue);
+        };
+
+        mResponse.set_status(pkg::STATUS_OK);
+        const std::size_t lEnvelopeLength = mResponse.ByteSizeLong();
+        std::size_t lTotalLength {lEnvelopeLength};
+        for(const auto& lValue : aValues)
+        {
+            const std::size_t lLength = lResultLength(lValue);
+            lTotalLength += 1 + VarintLength(lLength) + lLength;
+        }
+        if(lTotalLength > MaxFrameLength(mVersion))
+        {
+            ReplyTooLarge();
+            return;
+        }
+
+        EncodeLength(mVersion, static_cast<uint32_t>(lTotalLength), mResponses.AppendSpace(HeaderLength(mVersion)));
+        mResponse.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(mResponses.AppendSpace(lEnvelopeLength)));
+        for(const auto& lValue : aValues)
+        {
+            char lHeader[2 * (1 + gMaxVarintLength) + 2];
+            std::size_t lHeaderLength {0};
+            lHeader[lHeaderLength++] = static_cast<char>((pkg::Response::kResultsFieldNumber << 3) | 2);
+            lHeaderLength += EncodeVarint(lResultLength(lValue), lHeader + lHeaderLength);
+            if(lValue == nullptr)
+            {
+                lHeader[lHeaderLength++] = static_cast<char>(pkg::Result::kStatusFieldNumber << 3);
+                lHeader[lHeaderLength++] = static_cast<char>(pkg::STATUS_NOT_FOUND);
+                mResponses.Append(std::string_view(lHeader, lHeaderLength));
+                continue;
+            }
+
+            if(SendsCompressed(*lValue))
+            {
+                lHeader[lHeaderLength++] = static_cast<char>(pkg::Result::kCodecFieldNumber << 3);
+                lHeader[lHeaderLength++] = static_cast<char>(lValue->GetCodec());
+            }
+            lHeader[lHeaderLength++] = static_cast<char>((pkg::Result::kValueFieldNumber << 3) | 2);
+            lHeaderLength += EncodeVarint(WireSize(*lValue), lHeader + lHeaderLength);
+            mResponses.Append(std::string_view(lHeader, lHeaderLength));
+            AppendValue(lValue);
+        }
     }
 
-    std::shared_ptr<tcp::socket> GetSocket() 
-    { 
-        return mSocket; 
+    // Compressed values go out as stored when the client asked for that; everything else,
+    // native integers included, is sent as the client wrote it.
+    bool SendsStored(const Value& aValue) const
+    {
+        return aValue.GetCodec() == Codec::NONE || SendsCompressed(aValue);
     }
 
+    bool SendsCompressed(const Value& aValue) const
+    {
+        return mAcceptCompressed && aValue.GetCodec() == Codec::LZ4;
+    }
 
-private:
-    template<typename T>
-    T ConvertTo(const std::string& argInputString)
+    std::size_t WireSize(const Value& aValue) const
     {
-        T temp{};
-        std::stringstream lStringStream(argInputString);
-        lStringStream >> temp;
-        return temp;
+        return SendsStored(aValue) ? aValue.Size() : aValue.DecodedSize();
+    }
+
+    // Appends the WireSize bytes of the value: by reference when sent as stored, otherwise
+    // decompressed straight into the reply.
+    void AppendValue(InMemoryDB::ValueHandle aValue)
+    {
+        if(SendsStored(*aValue))
+        {
+            mResponses.Append(std::move(aValue));
+            return;
+        }
+        if(aValue->Decode(mResponses.AppendSpace(aValue->DecodedSize())) == false)
+        {
+            LOG_ERROR("Stored value failed to decompress.");
+        }
     }
 
     boost::asio::io_context& mIOContext;
     std::shared_ptr<tcp::socket> mSocket;
-    boost::asio::streambuf mStreamHeaderBuffer;
-    static constexpr int mMsgHeaderLength {8};
-    char mHeaderBuffer[mMsgHeaderLength];
-    std::vector<char> mReadBuffer;
+    ProtocolVersion mVersion {ProtocolVersion::ASCII_V1};
+    FrameBuffer mRecvBuffer;
+    pkg::Request mRequest;
+    pkg::Response mResponse;
+    bool mStructuredReplies {false};
+    bool mAcceptCompressed {false};
+    std::vector<std::string_view> mBatchKeys;
+    std::vector<std::string> mBatchPayloads;
+    std::vector<InMemoryDB::ValueHandle> mBatchValues;
+    std::vector<bool> mBatchFound;
+    std::vector<std::string> mScanKeys;
+    static constexpr std::size_t mDefaultScanLimit {100};
+    static constexpr std::size_t mDefaultScanCount {10};
+    static constexpr std::size_t mMaxScanLimit {1000};
+    // Replies being queued, and the ones the write in flight is sending.
+    ResponseBuffer mResponses;
+    ResponseBuffer mInFlight;
+    std::vector<boost::asio::const_buffer> mWriteBuffers;
+    static constexpr std::size_t mMaxQueuedBytes {4 * 1024 * 1024};
+    static constexpr std::string_view mReplyTooLarge {"Reply too large for the protocol version."};
+    bool mWriting {false};
+    bool mReadPaused {false};
+    bool mKeepAlive {true};
+    // Counted as open once accepted; the object exists from before the accept.
+    bool mAccepted {false};
+    // Tracing: when the last read completed, when the header of the frame still being read came
+    // in (default when none), and when the request being handled was parsed. Traces of the
+    // requests with replies in mResponses, and in mInFlight.
+    RequestTrace::Clock::time_point mReadAt {};
+    RequestTrace::Clock::time_point mHeaderReadAt {};
+    RequestTrace::Clock::time_point mParsedAt {};
+    bool mTracing {false};
+    std::vector<RequestTrace> mTraces;
+    std::vector<RequestTrace> mInFlightTraces;
 };
 
+// The metrics in the Prometheus text exposition format.
+static std::string PrometheusText()
+{
+    const InMemoryDB::Stats lStats = gInMemoryDB.GetStats();
+    const Metrics::Totals lTotals = Metrics::Instance().Collect();
+    std::ostringstream lOut;
+    const auto lMetric = [&lOut](std::string_view aName, std::string_view aType, std::string_view aHelp, auto aValue){
+        lOut << "# HELP inmemorydb_" << aName << ' ' << aHelp << "\n"
+             << "# TYPE inmemorydb_" << aName << ' ' << aType << "\n"
+             << "inmemorydb_" << aName << ' ' << aValue << "\n";
+    };
+
+    lMetric("keys", "gauge", "Keys stored.", lStats.mKeys);
+    lMetric("used_memory_bytes", "gauge", "Memory charged to the stored entries.", lStats.mUsedMemory);
+    lMetric("max_memory_bytes", "gauge", "Memory limit, 0 when unbounded.", lStats.mMaxMemory);
+    lMetric("resident_memory_bytes", "gauge", "Resident set size of the process.", ResidentMemory());
+    lMetric("slab_used_bytes", "gauge", "Bytes of slab chunks holding values.", lStats.mSlabUsed);
+    lMetric("slab_allocated_bytes", "gauge", "Bytes of slab pages mapped.", lStats.mSlabAllocated);
+    lMetric("index_slots", "gauge", "Slots of the hash indexes.", lStats.mIndexSlots);
+    lMetric("index_load_factor", "gauge", "Keys per hash index slot.",
+            lStats.mIndexSlots == 0 ? 0.0 : static_cast<double>(lStats.mKeys) / static_cast<double>(lStats.mIndexSlots));
+    lMetric("evicted_keys_total", "counter", "Keys evicted under the memory limit.", lStats.mEvicted);
+    lMetric("expired_keys_total", "counter", "Keys removed once their TTL passed.", lStats.mExpired);
+    lMetric("compacted_values_total", "counter", "Values moved by slab compaction.", lStats.mCompacted);
+    lMetric("aof_write_errors_total", "counter", "Batches the append-only log failed to write.", lStats.mLogWriteErrors);
+    lMetric("aof_failed", "gauge", "1 once the append-only log stopped writing after an error.", lStats.mLogFailed ? 1 : 0);
+    lMetric("connections", "gauge", "Open client connections.", lTotals.mConnectionsOpened - lTotals.mConnectionsClosed);
+    lMetric("connections_total", "counter", "Client connections accepted.", lTotals.mConnectionsOpened);
+    lMetric("received_bytes_total", "counter", "Bytes read from clients.", lTotals.mBytesIn);
+    lMetric("sent_bytes_total", "counter", "Bytes written to clients.", lTotals.mBytesOut);
+    lMetric("queued_reply_bytes", "gauge", "Reply bytes being written to clients.", lTotals.mQueuedBytes);
+    lMetric("backpressure_pauses_total", "counter", "Times a connection stopped reading on a full write queue.", lTotals.mBackpressurePauses);
+
+    lOut << "# HELP inmemorydb_request_duration_seconds Time to handle a request, until its reply is queued.\n"
+         << "# TYPE inmemorydb_request_duration_seconds histogram\n";
+    for(std::size_t i = 0; i < static_cast<std::size_t>(pkg::Op_ARRAYSIZE); ++i)
+    {
+        const Metrics::OpTotals& lOp = lTotals.mOps[i];
+        if(lOp.mCount == 0)
+        {
+            continue;
+        }
+        const std::string lLabel = "op=\"" + OpName(i) + "\"";
+        uint64_t lCumulative {0};
+        for(std::size_t j = 0; j + 1 < LatencyBuckets::mNrOfBuckets; ++j)
+        {
+            lCumulative += lOp.mBuckets[j];
+            if(j % LatencyBuckets::mSplit == 0)
+            {
+                lOut << "inmemorydb_request_duration_seconds_bucket{" << lLabel << ",le=\""
+                     << static_cast<double>(LatencyBuckets::UpperBoundOf(j)) / 1e9 << "\"} " << lCumulative << "\n";
+            }
+        }
+        lOut << "inmemorydb_request_duration_seconds_bucket{" << lLabel << ",le=\"+Inf\"} " << lOp.mCount << "\n"
+             << "inmemorydb_request_duration_seconds_sum{" << lLabel << "} " << static_cast<double>(lOp.mNanos) / 1e9 << "\n"
+             << "inmemorydb_request_duration_seconds_count{" << lLabel << "} " << lOp.mCount << "\n";
+    }
+    return lOut.str();
+}
+
+// One scrape: reads a request, answers it and closes. The socket lives on a strand, shared with
+// the deadline that closes it when the exchange takes longer than mTimeout, so that idle or
+// trickling clients cannot hold on to connections.
+class MetricsSession : public std::enable_shared_from_this<MetricsSession>
+{
+public:
+    explicit MetricsSession(tcp::socket aSocket) : mSocket{std::move(aSocket)}, mDeadline{mSocket.get_executor()} {}
+
+    void Start()
+    {
+        mDeadline.expires_after(mTimeout);
+        mDeadline.async_wait([me=shared_from_this()](const boost::system::error_code& aError){
+            if(aError)
+            {
+                return;
+            }
+            boost::system::error_code lError;
+            me->mSocket.close(lError);
+        });
+
+        boost::asio::async_read_until(mSocket, boost::asio::dynamic_buffer(mRequest, mMaxRequestSize), "\r\n\r\n",
+            [me=shared_from_this()](const boost::system::error_code& aError, std::size_t){
+            if(aError)
+            {
+                me->mDeadline.cancel();
+                return;
+            }
+            me->Respond();
+        });
+    }
+
+private:
+    void Respond()
+    {
+        const bool lFound = mRequest.starts_with("GET /metrics ") || mRequest.starts_with("GET /metrics?");
+        const std::string lBody = lFound ? PrometheusText() : std::string{"Not found.\n"};
+        mResponse = lFound ? "HTTP/1.1 200 OK\r\n" : "HTTP/1.1 404 Not Found\r\n";
+        mResponse += "Content-Type: text/plain; version=0.0.4\r\nContent-Length: " + std::to_string(lBody.size()) + "\r\nConnection: close\r\n\r\n";
+        mResponse += lBody;
+        boost::asio::async_write(mSocket, boost::asio::buffer(mResponse), [me=shared_from_this()](const boost::system::error_code&, std::size_t){
+            me->mDeadline.cancel();
+            boost::system::error_code lError;
+            me->mSocket.shutdown(tcp::socket::shutdown_both, lError);
+        });
+    }
+
+    static constexpr std::size_t mMaxRequestSize {8192};
+    static constexpr std::chrono::seconds mTimeout {5};
+    tcp::socket mSocket;
+    boost::asio::steady_timer mDeadline;
+    std::string mRequest;
+    std::string mResponse;
+};
+
+// How connections are spread over the io threads.
+enum class IoModel
+{
+    // One io_context run by every thread; any thread may run any connection's handlers.
+    SHARED,
+    // One io_context per thread, each thread pinned to its own core with its own acceptor on
+    // the port (SO_REUSEPORT), so the kernel balances new connections over the threads and a
+    // connection's handlers always run on the core that accepted it, without the threads
+    // contending for a shared reactor.
+    PER_CORE
+};
+
+static bool ParseIoModel(std::string_view aText, IoModel& aModel)
+{
+    if(aText == "shared")
+    {
+        aModel = IoModel::SHARED;
+        return true;
+    }
+    if(aText == "per-core")
+    {
+        aModel = IoModel::PER_CORE;
+        return true;
+    }
+    return false;
+}
+
 class Server
 {
 public:
-    Server(int32_t aPort, int32_t aNrOfThreads=1) : mAcceptor{mIOContext, tcp::endpoint(tcp::v4(), aPort)} 
+    // A aMetricsPort of 0 serves no metrics endpoint.
+    Server(int32_t aPort, uint32_t aNrOfThreads, IoModel aModel, int32_t aMetricsPort) : mModel{aModel}, mNrOfThreads{std::max(aNrOfThreads, 1u)}
     {
-        AcceptConnections();
+        const std::size_t lNrOfWorkers = mModel == IoModel::PER_CORE ? mNrOfThreads : 1;
+        for(std::size_t i = 0; i < lNrOfWorkers; ++i)
+        {
+            mWorkers.push_back(std::make_unique<Worker>(aPort, mModel == IoModel::PER_CORE));
+            AcceptConnections(*mWorkers.back());
+        }
+        mExpiryTimer.emplace(boost::asio::make_strand(mWorkers.front()->mIOContext));
+        ScheduleExpiry();
+        if(aMetricsPort != 0)
+        {
+            mMetricsAcceptor.emplace(mWorkers.front()->mIOContext, tcp::endpoint{tcp::v4(), static_cast<unsigned short>(aMetricsPort)});
+            AcceptScrapes();
+        }
     }
 
-    void Run(const int32_t aNrOfThreads=1)
+    void Run()
     {   
-        for(int i = 0; i < aNrOfThreads; ++i)
+        for(uint32_t i = 0; i < mNrOfThreads; ++i)
         {
-            mThreadPool.emplace_back([this](){
-                mIOContext.run();   
+            Worker& lWorker = mModel == IoModel::PER_CORE ? *mWorkers[i] : *mWorkers.front();
+            mThreadPool.emplace_back([this, &lWorker, i](){
+                if(mModel == IoModel::PER_CORE)
+                {
+                    PinToCore(i);
+                }
+                lWorker.mIOContext.run();   
             });
         }
 
@@ -211,42 +1103,278 @@ public:
     }
 
 private:
+    using ReusePort = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+
+    // An io_context with its listening socket; per core workers are run by a single thread,
+    // which the concurrency hint lets the io_context rely on.
+    struct Worker
+    {
+        Worker(int32_t aPort, bool aPerCore) : mIOContext{aPerCore ? 1 : BOOST_ASIO_CONCURRENCY_HINT_DEFAULT}, mAcceptor{mIOContext}
+        {
+            const tcp::endpoint lEndpoint{tcp::v4(), static_cast<unsigned short>(aPort)};
+            mAcceptor.open(lEndpoint.protocol());
+            mAcceptor.set_option(tcp::acceptor::reuse_address(true));
+            if(aPerCore)
+            {
+                mAcceptor.set_option(ReusePort(true));
+            }
+            mAcceptor.bind(lEndpoint);
+            mAcceptor.listen();
+        }
+
+        boost::asio::io_context mIOContext;
+        tcp::acceptor mAcceptor;
+    };
+
+    static void PinToCore(uint32_t aIndex)
+    {
+        cpu_set_t lCores;
+        CPU_ZERO(&lCores);
+        CPU_SET(aIndex % std::max(std::thread::hardware_concurrency(), 1u), &lCores);
+        if(const int lError = pthread_setaffinity_np(pthread_self(), sizeof(lCores), &lCores); lError != 0)
+        {
+            LOG_WARNING("Could not pin io thread ", aIndex, " to its core: ", std::strerror(lError));
+        }
+    }
 
-    void AcceptConnections()
+    void AcceptConnections(Worker& aWorker)
     {
-        std::shared_ptr<Connection> lConnection = std::make_shared<Connection>(mIOContext);
-        mAcceptor.async_accept(*(lConnection->GetSocket().get()), [this, lConnection](boost::system::error_code aError){
+        std::shared_ptr<Connection> lConnection = std::make_shared<Connection>(aWorker.mIOContext);
+        aWorker.mAcceptor.async_accept(*(lConnection->GetSocket().get()), [this, &aWorker, lConnection](boost::system::error_code aError){
             if(!aError) 
             {
                 // Handle the connection                
-                lConnection->ReadMsgLength();                
+                lConnection->DetectProtocol();                
             }
             else
             {
-                std::cerr << "Error accepting connection: " << aError.message() << "\n";
+                LOG_ERROR("Error accepting connection: ", aError.message());
             }
 
-            this->AcceptConnections();
+            this->AcceptConnections(aWorker);
+        });
+    }
+
+    // Scrapes are served by the first worker's io threads, next to the client connections.
+    void AcceptScrapes()
+    {
+        mMetricsAcceptor->async_accept(boost::asio::make_strand(mWorkers.front()->mIOContext), [this](boost::system::error_code aError, tcp::socket aSocket){
+            if(!aError)
+            {
+                std::make_shared<MetricsSession>(std::move(aSocket))->Start();
+            }
+            else
+            {
+                LOG_ERROR("Error accepting metrics connection: ", aError.message());
+            }
+            AcceptScrapes();
         });
     }
 
-    boost::asio::io_context mIOContext;
-    tcp::acceptor mAcceptor;
+    // Active expiry runs once per expiry tick on its own strand of the first worker, so at most
+    // one pass is in flight and it never runs on more than one io thread at a time. Every mCompactionInterval
+    // ticks the same pass also compacts the value slabs.
+    void ScheduleExpiry()
+    {
+        mExpiryTimer->expires_after(InMemoryDB::mExpiryTick);
+        mExpiryTimer->async_wait([this](const boost::system::error_code& aError){
+            if(aError)
+            {
+                return;
+            }
+
+            const std::size_t lExpired = gInMemoryDB.ExpireTick();
+            if(lExpired > 0)
+            {
+                LOG_DEBUG("Expired ", lExpired, " keys.");
+            }
+            if(++mExpiryPasses % mCompactionInterval == 0)
+            {
+                const std::size_t lMoved = gInMemoryDB.CompactTick();
+                if(lMoved > 0)
+                {
+                    LOG_DEBUG("Compaction moved ", lMoved, " values.");
+                }
+            }
+            ScheduleExpiry();
+        });
+    }
+
+    const IoModel mModel;
+    const uint32_t mNrOfThreads;
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::optional<boost::asio::steady_timer> mExpiryTimer;
+    std::optional<tcp::acceptor> mMetricsAcceptor;
+    static constexpr uint32_t mCompactionInterval {10};
+    uint32_t mExpiryPasses {0};
     std::vector<std::thread> mThreadPool;
 };
 
 
-int main() {
-    std::cout << "Main thread id " << std::this_thread::get_id() << "\n";
+// Byte count with an optional k, m or g suffix (powers of 1024).
+static bool ParseMemorySize(std::string_view aText, std::size_t& aBytes)
+{
+    std::size_t lValue {0};
+    auto [lPtr, lError] = std::from_chars(aText.data(), aText.data() + aText.size(), lValue);
+    if(lError != std::errc{})
+    {
+        return false;
+    }
+
+    const std::string_view lSuffix {lPtr, static_cast<std::size_t>(aText.data() + aText.size() - lPtr)};
+    constexpr std::array<std::pair<std::string_view, uint32_t>, 7> lUnits {{
+        {"", 0}, {"k", 10}, {"K", 10}, {"m", 20}, {"M", 20}, {"g", 30}, {"G", 30}
+    }};
+    for(const auto& [lName, lShift] : lUnits)
+    {
+        if(lSuffix == lName)
+        {
+            aBytes = lValue << lShift;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool ParseSwitch(std::string_view aText, bool& aValue)
+{
+    if(aText != "on" && aText != "off")
+    {
+        return false;
+    }
+    aValue = aText == "on";
+    return true;
+}
+
+static bool ParseNumber(std::string_view aText, uint32_t& aValue)
+{
+    auto [lPtr, lError] = std::from_chars(aText.data(), aText.data() + aText.size(), aValue);
+    return lError == std::errc{} && lPtr == aText.data() + aText.size();
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t lMaxMemory {0};
+    std::size_t lCompressionThreshold {0};
+    EvictionPolicy lPolicy {EvictionPolicy::LRU};
+    std::string lLogPath;
+    FsyncPolicy lFsyncPolicy {FsyncPolicy::INTERVAL};
+    std::chrono::milliseconds lFsyncInterval {1000};
+    std::string lSnapshotPath;
+    uint32_t lSnapshotInterval {0};
+    bool lOrderedIndex {false};
+    IoModel lIoModel {IoModel::SHARED};
+    uint32_t lMetricsPort {0};
+    uint32_t lSlowThreshold {0};
+    uint32_t lSlowLogLength {Tracer::mDefaultSlowLogLength};
+    uint32_t lTraceSample {0};
+    for(int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string_view lOption {argv[i]};
+        LogLevel lLevel {};
+        if(lOption == "--log-level" && ParseLogLevel(argv[i + 1], lLevel))
+        {
+            Logger::Instance().SetLevel(lLevel);
+        }
+        else if(lOption == "--aof")
+        {
+            lLogPath = argv[i + 1];
+        }
+        else if(lOption == "--snapshot")
+        {
+            lSnapshotPath = argv[i + 1];
+        }
+        else if((lOption == "--max-memory" && ParseMemorySize(argv[i + 1], lMaxMemory)) ||
+                (lOption == "--compress-threshold" && ParseMemorySize(argv[i + 1], lCompressionThreshold)) ||
+                (lOption == "--eviction" && ParseEvictionPolicy(argv[i + 1], lPolicy)) ||
+                (lOption == "--fsync" && ParseFsyncPolicy(argv[i + 1], lFsyncPolicy, lFsyncInterval)) ||
+                (lOption == "--snapshot-interval" && ParseNumber(argv[i + 1], lSnapshotInterval)) ||
+                (lOption == "--ordered-index" && ParseSwitch(argv[i + 1], lOrderedIndex)) ||
+                (lOption == "--io-model" && ParseIoModel(argv[i + 1], lIoModel)) ||
+                (lOption == "--metrics-port" && ParseNumber(argv[i + 1], lMetricsPort) && lMetricsPort <= 65535) ||
+                (lOption == "--slowlog-threshold" && ParseNumber(argv[i + 1], lSlowThreshold)) ||
+                (lOption == "--slowlog-max-len" && ParseNumber(argv[i + 1], lSlowLogLength)) ||
+                (lOption == "--trace-sample" && ParseNumber(argv[i + 1], lTraceSample)))
+        {
+            // Applied to the store once every option is read.
+        }
+        else
+        {
+            LOG_WARNING("Ignoring unknown option ", lOption, " ", argv[i + 1]);
+        }
+    }
+
+    gInMemoryDB.ConfigureEviction(lMaxMemory, lPolicy);
+    if(lMaxMemory != 0)
+    {
+        LOG_INFO("Memory limited to ", lMaxMemory, " bytes, ", ToString(lPolicy), " eviction");
+    }
+    gInMemoryDB.ConfigureCompression(lCompressionThreshold);
+    if(lCompressionThreshold != 0)
+    {
+        LOG_INFO("Compressing values of ", lCompressionThreshold, " bytes and more");
+    }
+    gInMemoryDB.ConfigureOrderedIndex(lOrderedIndex);
+    Tracer::Instance().SetSlowThreshold(std::chrono::microseconds{lSlowThreshold});
+    Tracer::Instance().SetSlowLogLength(lSlowLogLength);
+    Tracer::Instance().SetSampleEvery(lTraceSample);
+    if(lSlowThreshold != 0)
+    {
+        LOG_INFO("Logging requests slower than ", lSlowThreshold, " us");
+    }
+
+    LOG_INFO("Main thread id ", std::this_thread::get_id());
+#if defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+    LOG_INFO("Networking on io_uring");
+#endif
     try {
-        Server lServer{12345};
         const uint32_t lMaxNrOfThreads {std::thread::hardware_concurrency()};
-        lServer.Run(lMaxNrOfThreads);
+
+        // The snapshot is loaded first, then the logs written after it: the ones rotated by
+        // snapshots that did not complete, oldest first, and the current one. All of it happens
+        // before the log is attached and before the server accepts connections.
+        const auto lApply = [](const LogRecord& aRecord){
+            gInMemoryDB.ReplayRecord(aRecord);
+        };
+        if(lSnapshotPath.empty() == false)
+        {
+            Snapshotter::Load(lSnapshotPath, lMaxNrOfThreads, lApply);
+        }
+
+        std::unique_ptr<AppendLog> lLog;
+        if(lLogPath.empty() == false)
+        {
+            for(const std::string& lRotated : AppendLog::RotatedFiles(lLogPath))
+            {
+                AppendLog::Replay(lRotated, lMaxNrOfThreads, lApply);
+            }
+            const std::size_t lValidLength = AppendLog::Replay(lLogPath, lMaxNrOfThreads, lApply);
+            lLog = std::make_unique<AppendLog>(lLogPath, lValidLength, lFsyncPolicy, lFsyncInterval);
+            gInMemoryDB.AttachLog(lLog.get());
+        }
+        LOG_INFO("Starting with ", gInMemoryDB.Size(), " keys");
+
+        std::unique_ptr<Snapshotter> lSnapshotter;
+        if(lSnapshotPath.empty() == false)
+        {
+            lSnapshotter = std::make_unique<Snapshotter>(gInMemoryDB, lSnapshotPath, lLog.get(), std::chrono::seconds{lSnapshotInterval});
+            gSnapshotter = lSnapshotter.get();
+        }
+
+        Server lServer{12345, lMaxNrOfThreads, lIoModel, static_cast<int32_t>(lMetricsPort)};
+        if(lMetricsPort != 0)
+        {
+            LOG_INFO("Serving Prometheus metrics on port ", lMetricsPort, " at /metrics");
+        }
+        if(lIoModel == IoModel::PER_CORE)
+        {
+            LOG_INFO("Running ", lMaxNrOfThreads, " io threads, one io_context per core");
+        }
+        lServer.Run();
     } catch (std::exception& e) {
-        std::cerr << "Exception: " << e.what() << "\n";
+        LOG_ERROR("Exception: ", e.what());
     }
 
-    std::cout << "Exiting...\n";
+    LOG_INFO("Exiting...");
     google::protobuf::ShutdownProtobufLibrary();
 
     return 0;